@@ -1,8 +1,9 @@
 #ifndef _EGFX_ASYNC_BUFFER_PUSH_TASK_h
 #define _EGFX_ASYNC_BUFFER_PUSH_TASK_h
 
-#define _TASK_OO_CALLBACKS
-#include <TSchedulerDeclarations.hpp>
+#include "EngineRunner.h"
+
+#include "SharedBusArbiter.h"
 
 //#include <ArduinoGraphicsCore.h>
 //#include "DisplaySyncType.h"
@@ -14,7 +15,7 @@ namespace Egfx
 	/// </summary>
 	/// <typeparam name="ScreenDriverType">The type of the screen driver that will receive the buffer data.</typeparam>
 	template<typename ScreenDriverType>
-	class AsyncBufferPushTask : public TS::Task
+	class AsyncBufferPushTask : public EngineTask
 	{
 	private:
 		enum class PushStateEnum : uint8_t
@@ -22,7 +23,8 @@ namespace Egfx
 			Idle,
 			Start,
 			Pushing,
-			End
+			End,
+			Background
 		};
 
 	private:
@@ -31,6 +33,13 @@ namespace Egfx
 	private:
 		uint8_t* Buffer = nullptr;
 
+		// Optional shared bus, held for the whole push.
+		SharedBusArbiter* BusArbiter = nullptr;
+
+		// Stepped background work after each push, such as the back buffer clear.
+		bool (*BackgroundStep)(void* parameter) = nullptr;
+		void* BackgroundParameter = nullptr;
+
 	private:
 #if defined(EGFX_PERFORMANCE_LOG)
 		uint32_t PushStartTimestamp = 0;
@@ -38,13 +47,57 @@ namespace Egfx
 #endif
 		PushStateEnum PushState = PushStateEnum::Idle;
 
+		// Push signals, when supported by the driver.
+		// Single writer counters: the driver callback (possibly an ISR) only increments SignalCount.
+		volatile uint8_t SignalCount = 0;
+		uint8_t ServiceCount = 0;
+		bool SignalEnabled = false;
+
 	public:
-		AsyncBufferPushTask(TS::Scheduler& scheduler, ScreenDriverType& screenDriver)
-			: TS::Task(TASK_IMMEDIATE, TASK_FOREVER, &scheduler, false)
+		AsyncBufferPushTask(EngineScheduler& scheduler, ScreenDriverType& screenDriver)
+			: EngineTask(TASK_IMMEDIATE, TASK_FOREVER, &scheduler, false)
 			, ScreenDriver(screenDriver)
 		{
 		}
 
+		/// <summary>
+		/// Registers for driver push signals. Call after the driver is constructed.
+		/// When supported, the driver is only serviced when it signals, instead of polled on every pass.
+		/// </summary>
+		void Start()
+		{
+			SignalEnabled = ScreenDriver.SetPushCallback(OnPushSignal, this);
+		}
+
+		void Stop()
+		{
+			ScreenDriver.SetPushCallback(nullptr, nullptr);
+			SignalEnabled = false;
+			if (BusArbiter != nullptr)
+			{
+				BusArbiter->Leave(this);
+			}
+		}
+
+		/// <summary>
+		/// Sets the arbiter for a bus shared with other screen drivers, nullptr for a dedicated bus.
+		/// Each push waits for the bus and holds it until the frame is done.
+		/// </summary>
+		void SetBusArbiter(SharedBusArbiter* busArbiter)
+		{
+			BusArbiter = busArbiter;
+		}
+
+		/// <summary>
+		/// Sets the background work, stepped after each push until it returns true.
+		/// Abandoned when the next push starts: the owner must be able to finish it.
+		/// </summary>
+		void SetBackgroundStep(bool (*step)(void* parameter), void* parameter)
+		{
+			BackgroundStep = step;
+			BackgroundParameter = parameter;
+		}
+
 		void SetBufferTaskCallback(void (*taskCallback)(void* parameter))
 		{
 			ScreenDriver.SetBufferTaskCallback(taskCallback);
@@ -57,7 +110,16 @@ namespace Egfx
 
 		bool CanPushBuffer() const
 		{
-			return PushState == PushStateEnum::Idle && ScreenDriver.CanPushBuffer();
+			return (PushState == PushStateEnum::Idle || PushState == PushStateEnum::Background)
+				&& ScreenDriver.CanPushBuffer();
+		}
+
+		/// <summary>
+		/// Bytes of the pushing buffer the driver has released, 0 when not pushing.
+		/// </summary>
+		size_t GetPushedSize()
+		{
+			return (PushState == PushStateEnum::Pushing) ? ScreenDriver.GetPushedSize() : 0;
 		}
 
 		uint32_t GetPushDuration() const
@@ -75,8 +137,8 @@ namespace Egfx
 			{
 				Buffer = frameBuffer;
 				PushState = PushStateEnum::Start;
-				TS::Task::enableDelayed(0);
-				TS::Task::forceNextIteration();
+				EngineTask::enableDelayed(0);
+				EngineTask::forceNextIteration();
 			}
 		}
 
@@ -85,43 +147,127 @@ namespace Egfx
 			switch (PushState)
 			{
 			case PushStateEnum::Idle:
-				TS::Task::disable();
+				EngineTask::disable();
 				break;
 			case PushStateEnum::Start:
-				if (ScreenDriver.CanPushBuffer())
+				if (AcquireReady())
 				{
 #if defined(EGFX_PERFORMANCE_LOG)
 					PushStartTimestamp = micros();
 #endif
+					ServiceCount = SignalCount;
 					ScreenDriver.StartBuffer();
-					TS::Task::delay(ScreenDriver.PushBuffer(Buffer));
+					EngineTask::delay(ScreenDriver.PushBuffer(Buffer));
 					PushState = PushStateEnum::Pushing;
 				}
 				else
 				{
-					TS::Task::delay(0);
+					EngineTask::delay(0);
 				}
 				break;
 			case PushStateEnum::Pushing:
-				TS::Task::delay(0);
+				EngineTask::delay(0);
+				if (SignalEnabled)
+				{
+					if (ServiceCount == SignalCount)
+					{
+						// Nothing to service until the driver signals.
+						// Keeps polling the counter: the signal may come from an ISR or another thread,
+						// where the task can't be safely re-enabled.
+						break;
+					}
+					ServiceCount++;
+				}
+
 				if (!ScreenDriver.PushingBuffer(Buffer))
 				{
-					PushState = PushStateEnum::End;
+					// Push done, end in this pass.
+					EndPush();
+				}
+				break;
+			case PushStateEnum::Background:
+				if (StepBackground())
+				{
+					PushState = PushStateEnum::Idle;
+					EngineTask::disable();
+				}
+				else
+				{
+					EngineTask::delay(0);
 				}
 				break;
 			case PushStateEnum::End:
 			default:
-				ScreenDriver.EndBuffer();
-				Buffer = nullptr;
-				PushState = PushStateEnum::Idle;
-				TS::Task::disable();
-#if defined(EGFX_PERFORMANCE_LOG)
-				LastPushDuration = micros() - PushStartTimestamp;
-#endif
+				EndPush();
 				break;
 			}
 			return true;
 		}
+
+	private:
+		/// <summary>
+		/// Takes the bus, if shared, and checks the driver is ready to push.
+		/// The driver is only polled with the bus held, as it may still be stepping its init sequence,
+		/// and the bus is released right away if the driver isn't ready.
+		/// </summary>
+		bool AcquireReady()
+		{
+			if (BusArbiter == nullptr)
+			{
+				return ScreenDriver.CanPushBuffer();
+			}
+
+			if (!BusArbiter->TryAcquire(this))
+			{
+				return false;
+			}
+
+			if (ScreenDriver.CanPushBuffer())
+			{
+				return true;
+			}
+
+			BusArbiter->Release(this);
+
+			return false;
+		}
+
+		void EndPush()
+		{
+			ScreenDriver.EndBuffer();
+			Buffer = nullptr;
+			if (BusArbiter != nullptr)
+			{
+				BusArbiter->Release(this);
+			}
+#if defined(EGFX_PERFORMANCE_LOG)
+			LastPushDuration = micros() - PushStartTimestamp;
+#endif
+			if (StepBackground())
+			{
+				PushState = PushStateEnum::Idle;
+				EngineTask::disable();
+			}
+			else
+			{
+				PushState = PushStateEnum::Background;
+				EngineTask::delay(0);
+			}
+		}
+
+		bool StepBackground()
+		{
+			return BackgroundStep == nullptr || BackgroundStep(BackgroundParameter);
+		}
+
+		/// <summary>
+		/// Driver push signal, possibly from an ISR or another thread: only counts the signal, never touches the task.
+		/// </summary>
+		static void OnPushSignal(void* parameter)
+		{
+			AsyncBufferPushTask* self = static_cast<AsyncBufferPushTask*>(parameter);
+			self->SignalCount = self->SignalCount + 1;
+		}
 	};
 }
 #endif
\ No newline at end of file
@@ -1,8 +1,7 @@
 #ifndef _GRAPHICS_DUAL_BUFFER_TASK_h
 #define _GRAPHICS_DUAL_BUFFER_TASK_h
 
-#define _TASK_OO_CALLBACKS
-#include <TSchedulerDeclarations.hpp>
+#include "EngineRunner.h"
 
 #include "DisplaySyncType.h"
 #include "AsyncBufferPushTask.h"
@@ -10,7 +9,7 @@
 namespace Egfx
 {
 	template<typename FramebufferType, typename ScreenDriverType>
-	class DisplayEngineTask : public IFrameEngine, private TS::Task
+	class DisplayEngineTask : public IFrameEngine, private EngineTask
 	{
 	private:
 		enum class StateEnum : uint8_t
@@ -51,23 +50,28 @@ namespace Egfx
 
 		IFrameDraw* Drawer = nullptr;
 
+		// Optional shared bus, for the screen start sequence.
+		SharedBusArbiter* BusArbiter = nullptr;
+
 	private:
 		uint32_t SyncReference = 0;
 		StateEnum State = StateEnum::WaitForScreenStart;
 		DisplaySyncType SyncType = DisplaySyncType::Vrr;
+		bool Retained = false;
 
 	public:
-		DisplayEngineTask(TS::Scheduler& scheduler,
+		DisplayEngineTask(EngineScheduler& scheduler,
 			FramebufferType& framebuffer,
 			ScreenDriverType& screenDriver,
 			const uint32_t targetPeriodMicros = 16666)
 			: IFrameEngine()
-			, TS::Task(TASK_IMMEDIATE, TASK_FOREVER, &scheduler, false)
+			, EngineTask(TASK_IMMEDIATE, TASK_FOREVER, &scheduler, false)
 			, BufferPusher(scheduler, screenDriver)
 			, FrameBuffer(framebuffer)
 			, ScreenDriver(screenDriver)
 		{
 			SetTargetPeriod(targetPeriodMicros);
+			BufferPusher.SetBackgroundStep(OnBackgroundStep, this);
 		}
 
 		void SetTargetPeriod(const uint32_t targetPeriodMicros)
@@ -80,6 +84,26 @@ namespace Egfx
 			SyncType = syncType;
 		}
 
+		/// <summary>
+		/// Retained mode keeps the framebuffer between frames: the per-frame clear is skipped and drawers only draw what changed.
+		/// For immediate-mode drivers, whose push skips unchanged rows, e.g. row hash drivers with hardware accelerated drawing.
+		/// Requires a single-buffered framebuffer.
+		/// </summary>
+		void SetRetained(const bool retained)
+		{
+			Retained = retained;
+		}
+
+		/// <summary>
+		/// Sets the arbiter for a bus shared with other displays, nullptr for a dedicated bus.
+		/// Set before Start().
+		/// </summary>
+		void SetBusArbiter(SharedBusArbiter* busArbiter)
+		{
+			BusArbiter = busArbiter;
+			BufferPusher.SetBusArbiter(busArbiter);
+		}
+
 		void SetBufferTaskCallback(void (*taskCallback)(void* parameter))
 		{
 			BufferPusher.SetBufferTaskCallback(taskCallback);
@@ -118,8 +142,9 @@ namespace Egfx
 			{
 				if (ScreenDriver.Start())
 				{
-					TS::Task::enableDelayed(0);
-					TS::Task::forceNextIteration();
+					BufferPusher.Start();
+					EngineTask::enableDelayed(0);
+					EngineTask::forceNextIteration();
 					State = StateEnum::WaitForScreenStart;
 
 					return true;
@@ -132,8 +157,13 @@ namespace Egfx
 
 		void Stop() final
 		{
+			BufferPusher.Stop();
+			if (BusArbiter != nullptr)
+			{
+				BusArbiter->Leave(this);
+			}
 			ScreenDriver.Stop();
-			TS::Task::disable();
+			EngineTask::disable();
 		}
 
 		virtual void GetDisplayTimings(DisplayTimingsStruct& timings) const
@@ -160,7 +190,7 @@ namespace Egfx
 			switch (State)
 			{
 			case StateEnum::WaitForScreenStart:
-				if (ScreenDriver.CanPushBuffer())
+				if (ScreenStarted())
 				{
 					State = StateEnum::Clear;
 					FrameTiming.FrameCounter = UINT16_MAX; // Clear step will increment to 0.
@@ -176,7 +206,7 @@ namespace Egfx
 #if defined(EGFX_PERFORMANCE_LOG) && defined(EGFX_PERFORMANCE_LOG_DETAIL)
 				StepTimestamp = micros();
 #endif				
-				if (FrameBuffer.ClearFrameBuffer())
+				if (Retained || FrameBuffer.ClearFrameBuffer())
 				{
 					State = StateEnum::Render;
 					FrameTiming.FrameCounter++;
@@ -241,6 +271,11 @@ namespace Egfx
 					FrameTiming.PushDuration = micros() - MeasureTimestamp;
 #endif
 				}
+				else if (!Retained)
+				{
+					// Clear the already pushed part of the single buffer, while the rest is pushed.
+					FrameBuffer.ClearPushed(BufferPusher.GetPushedSize());
+				}
 				break;
 			case StateEnum::FinalizeFrame:
 				State = StateEnum::Clear;
@@ -255,7 +290,7 @@ namespace Egfx
 #endif
 				break;
 			default:
-				TS::Task::disable();
+				EngineTask::disable();
 				return false;
 				break;
 			}
@@ -264,6 +299,37 @@ namespace Egfx
 		}
 
 	private:
+		/// <summary>
+		/// Steps the screen start sequence, only while holding the bus when shared.
+		/// </summary>
+		bool ScreenStarted()
+		{
+			if (BusArbiter == nullptr)
+			{
+				return ScreenDriver.CanPushBuffer();
+			}
+
+			if (!BusArbiter->TryAcquire(this))
+			{
+				return false;
+			}
+
+			const bool started = ScreenDriver.CanPushBuffer();
+			BusArbiter->Release(this);
+
+			return started;
+		}
+
+		/// <summary>
+		/// Background work after each push: the back buffer clear, when multi-buffered.
+		/// </summary>
+		static bool OnBackgroundStep(void* parameter)
+		{
+			DisplayEngineTask* engine = static_cast<DisplayEngineTask*>(parameter);
+
+			return engine->Retained || engine->FrameBuffer.ClearBackBuffer();
+		}
+
 		bool Sync(const uint32_t timestamp)
 		{
 			const uint32_t syncElapsed = timestamp - SyncReference;
@@ -299,18 +365,18 @@ namespace Egfx
 			if (synced)
 			{
 				FrameTiming.FrameDuration = syncElapsed;
-				TS::Task::delay(0);
+				EngineTask::delay(0);
 			}
 			else
 			{
 				if (syncElapsed <= FrameTiming.TargetDuration)
 				{
 					const uint32_t sleepDuration = IntegerSignal::MaxValue<uint32_t>(1, (FrameTiming.TargetDuration - syncElapsed) / 1000) - 1;
-					TS::Task::delay(sleepDuration);
+					EngineTask::delay(sleepDuration);
 				}
 				else
 				{
-					TS::Task::delay(0);
+					EngineTask::delay(0);
 				}
 			}
 
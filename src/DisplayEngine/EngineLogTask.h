@@ -1,15 +1,14 @@
 #ifndef _EGFX_DISPLAY_ENGINE_LOG_TASK_h
 #define _EGFX_DISPLAY_ENGINE_LOG_TASK_h
 
-#define _TASK_OO_CALLBACKS
-#include <TSchedulerDeclarations.hpp>
+#include "EngineRunner.h"
 
 #include <EgfxCore.h>
 
 namespace Egfx
 {
 	template<const uint32_t LogPeriodMillis = 1000>
-	class PerformanceLogTask : public TS::Task
+	class PerformanceLogTask : public EngineTask
 	{
 	private:
 		IFrameEngine& Engine;
@@ -26,8 +25,8 @@ namespace Egfx
 		Print& SerialInstance;
 
 	public:
-		PerformanceLogTask(TS::Scheduler& scheduler, IFrameEngine& engine, Print& serial = Serial)
-			: TS::Task(LogPeriodMillis, TASK_FOREVER, &scheduler, false)
+		PerformanceLogTask(EngineScheduler& scheduler, IFrameEngine& engine, Print& serial = Serial)
+			: EngineTask(LogPeriodMillis, TASK_FOREVER, &scheduler, false)
 			, Engine(engine)
 			, SerialInstance(serial)
 		{
@@ -35,12 +34,12 @@ namespace Egfx
 
 		void Start()
 		{
-			TS::Task::enableDelayed(LogPeriodMillis);
+			EngineTask::enableDelayed(LogPeriodMillis);
 		}
 
 		void Stop()
 		{
-			TS::Task::disable();
+			EngineTask::disable();
 		}
 
 	public:
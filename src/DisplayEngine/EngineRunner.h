@@ -0,0 +1,301 @@
+#ifndef _EGFX_ENGINE_RUNNER_h
+#define _EGFX_ENGINE_RUNNER_h
+
+/// <summary>
+/// Engine runner selection.
+/// The engine tasks only rely on a small cooperative task contract:
+///	EngineTask(interval, iterations, EngineScheduler*, enable), virtual bool Callback(),
+///	enableDelayed(), delay(), disable(), forceNextIteration(), isEnabled().
+/// Tasks leave their scheduler when destroyed, or with the scheduler's deleteTask().
+/// Delays are in milliseconds.
+///
+/// Default on Arduino: TaskScheduler adapter, the engine tasks are TS::Task.
+/// EGFX_RUNNER_LOOP (and always on host): built-in EngineRunner, a minimal zero-allocation cooperative loop.
+/// On host, EngineThreadRunner runs the same loop in a std::thread.
+/// </summary>
+#if defined(EGFX_RUNNER_LOOP) || !defined(ARDUINO)
+#include <stdint.h>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include "../ScreenDrivers/Mock/MockClock.h"
+#endif
+
+#if !defined(TASK_IMMEDIATE)
+#define TASK_IMMEDIATE 0
+#endif
+
+#if !defined(TASK_FOREVER)
+#define TASK_FOREVER (-1)
+#endif
+
+namespace Egfx
+{
+	class EngineRunner;
+
+	/// <summary>
+	/// Cooperative task for the built-in EngineRunner.
+	/// Same contract as TaskScheduler's TS::Task with OO callbacks, for the subset used by the engine.
+	/// Iterations are not tracked, tasks run until disabled.
+	/// A task unlinks itself from its runner when destroyed.
+	/// </summary>
+	class EngineTask
+	{
+		friend class EngineRunner;
+
+	private:
+		EngineRunner* Runner = nullptr;
+		EngineTask* Next = nullptr;
+
+		uint32_t Interval;
+		uint32_t Start = 0;
+		uint32_t Delay = 0;
+		bool Enabled = false;
+
+	public:
+		EngineTask(const uint32_t interval, const int32_t /*iterations*/, EngineRunner* runner, const bool enable);
+
+		virtual ~EngineTask();
+
+		virtual bool Callback() = 0;
+
+		void enable()
+		{
+			enableDelayed(0);
+		}
+
+		void enableDelayed(const uint32_t delay)
+		{
+			Start = millis();
+			Delay = delay;
+			Enabled = true;
+		}
+
+		/// <summary>
+		/// Delays the next run from now. 0 delays by the interval.
+		/// </summary>
+		void delay(const uint32_t delay = 0)
+		{
+			Start = millis();
+			Delay = (delay > 0) ? delay : Interval;
+		}
+
+		void forceNextIteration()
+		{
+			Delay = 0;
+		}
+
+		void disable()
+		{
+			Enabled = false;
+		}
+
+		bool isEnabled() const
+		{
+			return Enabled;
+		}
+
+	private:
+		bool IsDue(const uint32_t timestamp) const
+		{
+			return Enabled && ((timestamp - Start) >= Delay);
+		}
+	};
+
+	/// <summary>
+	/// Minimal cooperative loop. Tasks are linked intrusively on construction, no allocation.
+	/// Call execute() from loop().
+	/// </summary>
+	class EngineRunner
+	{
+	private:
+		EngineTask* Head = nullptr;
+
+		// Next task of the running pass, kept valid if a callback removes it.
+		EngineTask* Cursor = nullptr;
+
+	public:
+		EngineRunner() {}
+
+		~EngineRunner()
+		{
+			// Tasks that outlive the runner must not unlink from it later.
+			while (Head != nullptr)
+			{
+				deleteTask(*Head);
+			}
+		}
+
+		/// <summary>
+		/// Links the task, moving it from its previous runner if any.
+		/// </summary>
+		void addTask(EngineTask& task)
+		{
+			if (task.Runner != nullptr)
+			{
+				task.Runner->deleteTask(task);
+			}
+
+			task.Runner = this;
+			task.Next = Head;
+			Head = &task;
+		}
+
+		/// <summary>
+		/// Unlinks the task, if it belongs to this runner. Safe from within a task callback.
+		/// </summary>
+		void deleteTask(EngineTask& task)
+		{
+			if (task.Runner != this)
+			{
+				return;
+			}
+
+			for (EngineTask** link = &Head; *link != nullptr; link = &(*link)->Next)
+			{
+				if (*link == &task)
+				{
+					*link = task.Next;
+					break;
+				}
+			}
+
+			if (Cursor == &task)
+			{
+				Cursor = task.Next;
+			}
+
+			task.Runner = nullptr;
+			task.Next = nullptr;
+		}
+
+		/// <summary>
+		/// Runs one pass over all due tasks.
+		/// </summary>
+		/// <returns>True if no task was due (idle pass).</returns>
+		bool execute()
+		{
+			bool idle = true;
+			const uint32_t timestamp = millis();
+
+			for (EngineTask* task = Head; task != nullptr; task = Cursor)
+			{
+				Cursor = task->Next;
+				if (task->IsDue(timestamp))
+				{
+					idle = false;
+					// Default to the interval, the callback may override it with delay().
+					task->Start = timestamp;
+					task->Delay = task->Interval;
+					task->Callback();
+				}
+			}
+			Cursor = nullptr;
+
+			return idle;
+		}
+	};
+
+	inline EngineTask::EngineTask(const uint32_t interval, const int32_t, EngineRunner* runner, const bool enable)
+		: Interval(interval)
+	{
+		if (runner != nullptr)
+		{
+			runner->addTask(*this);
+		}
+
+		if (enable)
+		{
+			enableDelayed(0);
+		}
+	}
+
+	inline EngineTask::~EngineTask()
+	{
+		if (Runner != nullptr)
+		{
+			Runner->deleteTask(*this);
+		}
+	}
+
+	using EngineScheduler = EngineRunner;
+
+#if !defined(ARDUINO)
+	/// <summary>
+	/// Host runner, the built-in loop in a std::thread.
+	/// Hold GetMutex() to access the engine or its tasks from another thread, including to destroy them.
+	/// </summary>
+	class EngineThreadRunner : public EngineRunner
+	{
+	private:
+		std::thread Thread;
+		std::mutex RunMutex;
+		std::atomic<bool> Running{ false };
+
+	public:
+		~EngineThreadRunner()
+		{
+			Stop();
+		}
+
+		std::mutex& GetMutex()
+		{
+			return RunMutex;
+		}
+
+		bool Start()
+		{
+			if (Running.exchange(true))
+			{
+				return false;
+			}
+
+			Thread = std::thread([this]
+				{
+					while (Running.load(std::memory_order_acquire))
+					{
+						bool idle;
+						{
+							std::lock_guard<std::mutex> lock(RunMutex);
+							idle = execute();
+						}
+
+						if (idle)
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+
+			return true;
+		}
+
+		void Stop()
+		{
+			Running.store(false, std::memory_order_release);
+			if (Thread.joinable())
+			{
+				Thread.join();
+			}
+		}
+	};
+#endif
+}
+#else
+#define _TASK_OO_CALLBACKS
+#include <TSchedulerDeclarations.hpp>
+
+namespace Egfx
+{
+	/// <summary>
+	/// TaskScheduler adapter.
+	/// </summary>
+	using EngineTask = TS::Task;
+	using EngineScheduler = TS::Scheduler;
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,95 @@
+#ifndef _EGFX_MULTI_DISPLAY_ENGINE_h
+#define _EGFX_MULTI_DISPLAY_ENGINE_h
+
+#include "SharedBusArbiter.h"
+#include "DisplayEngineTask.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Several displays on one shared bus, each with its own framebuffer/driver engine.
+	/// Pushes take turns on the bus, a whole frame at a time, while the other displays keep rendering.
+	/// The start sequences of the screens are also stepped between pushes.
+	/// Engines that may start or stop on their own can share a SharedBusArbiter directly instead.
+	/// </summary>
+	/// <typeparam name="maxDisplays">Maximum number of displays on the bus.</typeparam>
+	template<uint8_t maxDisplays>
+	class MultiDisplayEngine
+	{
+	private:
+		SharedBusArbiter BusArbiter{};
+
+		IFrameEngine* Engines[maxDisplays]{};
+		uint8_t Count = 0;
+
+	public:
+		MultiDisplayEngine() {}
+
+		/// <summary>
+		/// Adds a display engine to the shared bus. Add all displays before Start().
+		/// </summary>
+		/// <typeparam name="EngineType">DisplayEngineTask or compatible, with SetBusArbiter().</typeparam>
+		/// <returns>False if full.</returns>
+		template<typename EngineType>
+		bool Add(EngineType& engine)
+		{
+			if (Count >= maxDisplays)
+			{
+				return false;
+			}
+
+			engine.SetBusArbiter(&BusArbiter);
+			Engines[Count++] = &engine;
+
+			return true;
+		}
+
+		/// <summary>
+		/// The displays' shared bus, for other users of the bus, e.g. TemplateSSD1331Accelerator.
+		/// </summary>
+		SharedBusArbiter& GetBusArbiter()
+		{
+			return BusArbiter;
+		}
+
+		uint8_t GetCount() const
+		{
+			return Count;
+		}
+
+		/// <summary>
+		/// Display engine at index, for drawer and timings access.
+		/// </summary>
+		IFrameEngine* GetEngine(const uint8_t index)
+		{
+			return (index < Count) ? Engines[index] : nullptr;
+		}
+
+		/// <summary>
+		/// Starts all display engines. All are stopped if any fails.
+		/// </summary>
+		bool Start()
+		{
+			for (uint8_t i = 0; i < Count; i++)
+			{
+				if (!Engines[i]->Start())
+				{
+					Stop();
+
+					return false;
+				}
+			}
+
+			return Count > 0;
+		}
+
+		void Stop()
+		{
+			for (uint8_t i = 0; i < Count; i++)
+			{
+				Engines[i]->Stop();
+			}
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef _EGFX_SHARED_BUS_ARBITER_h
+#define _EGFX_SHARED_BUS_ARBITER_h
+
+#include <stdint.h>
+
+namespace Egfx
+{
+	/// <summary>
+	/// Cooperative ownership token for a bus shared by several screen drivers.
+	/// A frame push holds the bus from its start to its end, so transactions never interleave mid-frame.
+	/// Fair: requesters that find the bus taken queue in order, and a released bus goes to the longest waiting one.
+	/// Not thread safe, to be used from the scheduler's tasks only.
+	/// </summary>
+	class SharedBusArbiter
+	{
+	public:
+		/// <summary>
+		/// Queue capacity, further requesters retry without a place in line.
+		/// </summary>
+		static constexpr uint8_t MaxWaiting = 4;
+
+	private:
+		const void* Owner = nullptr;
+		const void* Waiting[MaxWaiting]{};
+		uint8_t WaitingCount = 0;
+
+	public:
+		/// <summary>
+		/// Takes the bus, if free and no other requester is ahead in line.
+		/// Otherwise, queues the requester.
+		/// </summary>
+		/// <param name="requester">Unique requester identity, usually its this pointer.</param>
+		/// <returns>True if the requester owns the bus.</returns>
+		bool TryAcquire(const void* requester)
+		{
+			if (Owner == requester)
+			{
+				return true;
+			}
+
+			if (Owner == nullptr
+				&& (WaitingCount == 0 || Waiting[0] == requester))
+			{
+				Owner = requester;
+				Dequeue(requester);
+
+				return true;
+			}
+
+			if (WaitingCount < MaxWaiting
+				&& !IsWaiting(requester))
+			{
+				Waiting[WaitingCount++] = requester;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Takes the bus only if free and no requester is waiting, without queuing.
+		/// For short transactions that have another way to get done when the bus is busy, e.g. hardware draw commands.
+		/// </summary>
+		/// <param name="requester">Unique requester identity, usually its this pointer.</param>
+		/// <returns>True if the requester owns the bus, release it right after the transaction.</returns>
+		bool TryAcquireIdle(const void* requester)
+		{
+			if (Owner == requester)
+			{
+				return true;
+			}
+
+			if (Owner == nullptr && WaitingCount == 0)
+			{
+				Owner = requester;
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Releases the bus, if owned by the requester.
+		/// </summary>
+		void Release(const void* requester)
+		{
+			if (Owner == requester)
+			{
+				Owner = nullptr;
+			}
+		}
+
+		/// <summary>
+		/// Drops the requester from the bus, owned or waiting. For when it stops.
+		/// </summary>
+		void Leave(const void* requester)
+		{
+			Release(requester);
+			Dequeue(requester);
+		}
+
+		bool IsOwner(const void* requester) const
+		{
+			return Owner == requester;
+		}
+
+	private:
+		bool IsWaiting(const void* requester) const
+		{
+			for (uint8_t i = 0; i < WaitingCount; i++)
+			{
+				if (Waiting[i] == requester)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void Dequeue(const void* requester)
+		{
+			for (uint8_t i = 0; i < WaitingCount; i++)
+			{
+				if (Waiting[i] == requester)
+				{
+					for (uint8_t j = i + 1; j < WaitingCount; j++)
+					{
+						Waiting[j - 1] = Waiting[j];
+					}
+					WaitingCount--;
+					Waiting[WaitingCount] = nullptr;
+					return;
+				}
+			}
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Framework/Assets/Shader/Color/Brightness.h"
 #include "Framework/Assets/Shader/Color/Contrast.h"
 #include "Framework/Assets/Shader/Color/Saturation.h"
+#include "Framework/Assets/Shader/Color/ChannelLut.h"
 
 // Transform shaders.
 #include "Framework/Assets/Shader/Transform/Translate.h"
@@ -21,6 +22,9 @@
 #include "Framework/Assets/Shader/Transform/Rotate.h"
 #include "Framework/Assets/Shader/Transform/DitherMask.h"
 
+// Bitmap drawers.
+#include "Framework/Assets/Bitmap/AffineDrawer.h"
+
 // Bitmask fonts.
 #include "Framework/Assets/Font/Bitmask/Plastic/Plastic.h" // Simple small font with 3x5 and 5x5 variants.
 #include "Framework/Assets/Font/Bitmask/Micron/Micron.h" // Subpixel-font with 1x5 and 2x5 variants.
@@ -16,6 +16,7 @@
 // Core interfaces.
 #include "Model/IFrameBuffer.h" // Framebuffer interface.
 #include "Model/IScreenDriver.h" // Screen driver interface.
+#include "Model/IScrollRegion.h" // Optional screen driver hardware scroll interface.
 
 #include "Model/IFrameDraw.h" // Display engine draw interface.
 #include "Model/IFrameEngine.h" // Display engine interface.
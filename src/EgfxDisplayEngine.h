@@ -10,6 +10,9 @@
 // Task based display engine.
 #include "DisplayEngine/DisplayEngineTask.h"
 
+// Several displays on one shared bus.
+#include "DisplayEngine/MultiDisplayEngine.h"
+
 // Optional performance logging task.
 #include "DisplayEngine/EngineLogTask.h"
 
@@ -63,6 +63,7 @@
 #include "Framework/Bitmask/Model.h"
 #include "Framework/Bitmask/TemplateDrawer.h"
 #include "Framework/Bitmask/TemplateDrawable.h"
+#include "Framework/Bitmask/RleDrawer.h"
 
 // Bitmask font, derives from bitmask graphics.
 #include "Framework/Bitmask/Font/Model.h"
@@ -72,6 +73,8 @@
 #include "Framework/Bitmap/Model.h"
 #include "Framework/Bitmap/TemplateDrawer.h"
 #include "Framework/Bitmap/TemplateDrawable.h"
+#include "Framework/Bitmap/OpaqueRuns.h"
+#include "Framework/Bitmap/RleDrawer.h"
 
 // Vector graphics.
 #include "Framework/Vector/Model.h"
@@ -0,0 +1,158 @@
+#ifndef _EGFX_ASYNC_BUFFER_FILL_h
+#define _EGFX_ASYNC_BUFFER_FILL_h
+
+#include "../Platform/Platform.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include "hardware/dma.h"
+#endif
+
+namespace Egfx
+{
+	/// <summary>
+	/// Stepped background fill of a buffer with a byte value, for framebuffer clears.
+	/// DMA memset on RP2040, chunked memset elsewhere.
+	/// Remembers the last filled buffer until released, so a pre-cleared buffer can skip its clear.
+	/// </summary>
+	/// <typeparam name="chunkSize">Bytes filled per Step() when no DMA is available.</typeparam>
+	template<size_t chunkSize>
+	class AsyncBufferFill
+	{
+	private:
+		static_assert(chunkSize > 0, "AsyncBufferFill chunk size must be at least 1.");
+
+		uint8_t* Target = nullptr;
+		uint8_t* Filled = nullptr;
+		size_t Size = 0;
+		size_t Index = 0;
+		uint8_t Value = 0;
+
+#if defined(ARDUINO_ARCH_RP2040)
+		// Fill source word, must outlive the DMA transfer.
+		uint32_t FillWord = 0;
+		int DmaChannel = -1;
+#endif
+
+	public:
+		bool IsBusy() const
+		{
+			return Target != nullptr;
+		}
+
+		/// <summary>
+		/// Buffer being filled, nullptr if idle.
+		/// </summary>
+		uint8_t* GetTarget() const
+		{
+			return Target;
+		}
+
+		/// <summary>
+		/// Last completed buffer, nullptr if released.
+		/// </summary>
+		uint8_t* GetFilled() const
+		{
+			return Filled;
+		}
+
+		/// <summary>
+		/// Forgets the last completed buffer, once it has been used.
+		/// </summary>
+		void Release()
+		{
+			Filled = nullptr;
+		}
+
+		/// <summary>
+		/// Starts filling a buffer. Call Step() until it returns true.
+		/// </summary>
+		/// <returns>False if busy with another buffer.</returns>
+		bool Start(uint8_t* target, const size_t size, const uint8_t value)
+		{
+			if (IsBusy() || target == nullptr)
+			{
+				return false;
+			}
+
+			Target = target;
+			Filled = nullptr;
+			Size = size;
+			Index = 0;
+			Value = value;
+
+#if defined(ARDUINO_ARCH_RP2040)
+			// Align destination to 32-bit boundary: pre-fill leading bytes until aligned.
+			while (((reinterpret_cast<uintptr_t>(&Target[Index]) & 0x3u) != 0) && Index < Size)
+			{
+				Target[Index++] = Value;
+			}
+
+			// Aligned body with 32 bit DMA writes, the tail bytes are left for after DMA.
+			const size_t wordCount = (Size - Index) / sizeof(uint32_t);
+			if (wordCount > 0)
+			{
+				FillWord = uint32_t(Value) * 0x01010101u;
+
+				DmaChannel = dma_claim_unused_channel(true);
+				dma_channel_config config = dma_channel_get_default_config(DmaChannel);
+				channel_config_set_read_increment(&config, false);
+				channel_config_set_write_increment(&config, true);
+				channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+
+				dma_channel_configure(DmaChannel, &config,
+					reinterpret_cast<uint32_t*>(&Target[Index]),
+					&FillWord,
+					wordCount,
+					true);
+
+				Index += wordCount * sizeof(uint32_t);
+			}
+#endif
+			return true;
+		}
+
+		/// <summary>
+		/// Advances the fill.
+		/// </summary>
+		/// <returns>True when done (or idle).</returns>
+		bool Step()
+		{
+			if (!IsBusy())
+			{
+				return true;
+			}
+
+#if defined(ARDUINO_ARCH_RP2040)
+			if (DmaChannel >= 0)
+			{
+				if (dma_channel_is_busy(DmaChannel))
+				{
+					return false;
+				}
+
+				dma_channel_unclaim(DmaChannel);
+				DmaChannel = -1;
+			}
+
+			// Tail bytes (size % 4).
+			memset(&Target[Index], Value, Size - Index);
+			Index = Size;
+#else
+			const size_t remaining = Size - Index;
+			const size_t size = (remaining > chunkSize) ? chunkSize : remaining;
+			memset(&Target[Index], Value, size);
+			Index += size;
+
+			if (Index < Size)
+			{
+				return false;
+			}
+#endif
+			Filled = Target;
+			Target = nullptr;
+
+			return true;
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -235,6 +235,45 @@ namespace Egfx
 			memset(Buffer, rawColor, BufferSize);
 		}
 
+		/// <summary>
+		/// Moves whole rows, overlap safe.
+		/// Rows are bits in 8-row pages, so page aligned moves copy whole pages and others copy one row bit at a time.
+		/// </summary>
+		void MoveRowsRaw(const pixel_t destinationRow, const pixel_t sourceRow, const pixel_t rowCount)
+		{
+			static constexpr size_t pageSize = sizeof(color_t) * frameWidth;
+
+			if ((destinationRow % 8) == 0 && (sourceRow % 8) == 0 && (rowCount % 8) == 0)
+			{
+				memmove(&Buffer[pageSize * (destinationRow / 8)], &Buffer[pageSize * (sourceRow / 8)], pageSize * (rowCount / 8));
+				return;
+			}
+
+			// Row order keeps overlapping source rows intact until moved.
+			for (pixel_t i = 0; i < rowCount; i++)
+			{
+				const pixel_t row = (destinationRow > sourceRow) ? (rowCount - 1 - i) : i;
+				const pixel_t fromRow = sourceRow + row;
+				const pixel_t toRow = destinationRow + row;
+				const uint8_t* from = &Buffer[pageSize * (fromRow / 8)];
+				uint8_t* to = &Buffer[pageSize * (toRow / 8)];
+				const uint8_t fromBit = fromRow % 8;
+				const uint8_t toMask = uint8_t(1) << (toRow % 8);
+
+				for (pixel_t x = 0; x < frameWidth; x++)
+				{
+					if (from[x] & (uint8_t(1) << fromBit))
+					{
+						to[x] |= toMask;
+					}
+					else
+					{
+						to[x] &= ~toMask;
+					}
+				}
+			}
+		}
+
 		template<bool inverted, uint8_t Sections>
 		void ClearRaw(const uint8_t section)
 		{
@@ -0,0 +1,217 @@
+#ifndef _EGFX_COLOR12_FRAME_PAINTER_h
+#define _EGFX_COLOR12_FRAME_PAINTER_h
+
+#include "AbstractFramePainter.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// A template class for painting packed 12-bit color framebuffer, providing low-level pixel drawing operations.
+	/// Pixels are stored as the 4-4-4 wire format of RGB panels: 2 pixels every 3 bytes (RG BR GB), contiguous across rows.
+	/// </summary>
+	/// <typeparam name="frameWidth">The width of the frame in pixels.</typeparam>
+	/// <typeparam name="frameHeight">The height of the frame in pixels.</typeparam>
+	/// <typeparam name="rotated">Whether the frame is rotated (width and height swapped).</typeparam>
+	template<pixel_t frameWidth, pixel_t frameHeight, bool rotated>
+	class Color12FramePainter : public AbstractFramePainter<ColorConverter12, frameWidth, frameHeight, rotated>
+	{
+	private:
+		using Base = AbstractFramePainter<ColorConverter12, frameWidth, frameHeight, rotated>;
+
+	protected:
+		using Base::Buffer;
+
+	public:
+		using Base::BufferSize;
+		using typename Base::color_t;
+
+	public:
+		Color12FramePainter(uint8_t* buffer = nullptr) : Base(buffer) {}
+
+	protected:
+		void PixelRaw(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const size_t index = ((size_t)frameWidth * y) + x;
+			const size_t offset = (index >> 1) * 3;
+
+			if (index & 1)
+			{
+				Buffer[offset + 1] = (Buffer[offset + 1] & 0xF0) | Rgb::R4(rawColor);
+				Buffer[offset + 2] = uint8_t(rawColor);
+			}
+			else
+			{
+				Buffer[offset] = uint8_t(rawColor >> 4);
+				Buffer[offset + 1] = (Buffer[offset + 1] & 0x0F) | (Rgb::B4(rawColor) << 4);
+			}
+		}
+
+		void PixelRawBlend(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			PixelRaw(Rgb::Color444From444(
+				(uint8_t(Rgb::R4(existingColor)) + Rgb::R4(rawColor)) >> 1,
+				(uint8_t(Rgb::G4(existingColor)) + Rgb::G4(rawColor)) >> 1,
+				(uint8_t(Rgb::B4(existingColor)) + Rgb::B4(rawColor)) >> 1), x, y);
+		}
+
+		void PixelRawBlendAlpha(const color_t rawColor, const pixel_t x, const pixel_t y, const uint8_t alpha)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			const uint8_t alphaInv = 255 - alpha;
+
+			// Mix in 4 bit color space, with 8 bit alpha.
+			PixelRaw(Rgb::Color444From444(
+				(((uint16_t)Rgb::R4(existingColor) * alphaInv) + ((uint16_t)Rgb::R4(rawColor) * alpha)) >> 8,
+				(((uint16_t)Rgb::G4(existingColor) * alphaInv) + ((uint16_t)Rgb::G4(rawColor) * alpha)) >> 8,
+				(((uint16_t)Rgb::B4(existingColor) * alphaInv) + ((uint16_t)Rgb::B4(rawColor) * alpha)) >> 8), x, y);
+		}
+
+		void PixelRawBlendAdd(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			PixelRaw(Rgb::Color444From444(
+				MinValue<uint8_t>(Rgb::R4(existingColor) + Rgb::R4(rawColor), 15),
+				MinValue<uint8_t>(Rgb::G4(existingColor) + Rgb::G4(rawColor), 15),
+				MinValue<uint8_t>(Rgb::B4(existingColor) + Rgb::B4(rawColor), 15)), x, y);
+		}
+
+		void PixelRawBlendSubtract(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			PixelRaw(Rgb::Color444From444(
+				MaxValue<int8_t>(int8_t(Rgb::R4(existingColor)) - Rgb::R4(rawColor), 0),
+				MaxValue<int8_t>(int8_t(Rgb::G4(existingColor)) - Rgb::G4(rawColor), 0),
+				MaxValue<int8_t>(int8_t(Rgb::B4(existingColor)) - Rgb::B4(rawColor), 0)), x, y);
+		}
+
+		void PixelRawBlendMultiply(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			PixelRaw(Rgb::Color444From444(
+				(uint8_t(Rgb::R4(existingColor)) * Rgb::R4(rawColor)) / 15,
+				(uint8_t(Rgb::G4(existingColor)) * Rgb::G4(rawColor)) / 15,
+				(uint8_t(Rgb::B4(existingColor)) * Rgb::B4(rawColor)) / 15), x, y);
+		}
+
+		void PixelRawBlendScreen(const color_t rawColor, const pixel_t x, const pixel_t y)
+		{
+			const color_t existingColor = GetPixelRaw(x, y);
+			PixelRaw(Rgb::Color444From444(
+				15 - (((15 - Rgb::R4(existingColor)) * (15 - Rgb::R4(rawColor))) / 15),
+				15 - (((15 - Rgb::G4(existingColor)) * (15 - Rgb::G4(rawColor))) / 15),
+				15 - (((15 - Rgb::B4(existingColor)) * (15 - Rgb::B4(rawColor))) / 15)), x, y);
+		}
+
+		void LineVerticalRaw(const color_t rawColor, const pixel_t x, const pixel_t y1, const pixel_t y2)
+		{
+			const pixel_t yStart = (y2 >= y1) ? y1 : y2;
+			const pixel_t yEnd = (y2 >= y1) ? y2 : y1;
+
+			for (pixel_t y = yStart; y <= yEnd; y++)
+			{
+				PixelRaw(rawColor, x, y);
+			}
+		}
+
+		void LineHorizontalRaw(const color_t rawColor, const pixel_t x1, const pixel_t y, const pixel_t x2)
+		{
+			const pixel_t xStart = (x2 >= x1) ? x1 : x2;
+			const pixel_t xEnd = (x2 >= x1) ? x2 : x1;
+
+			size_t index = ((size_t)frameWidth * y) + xStart;
+			const size_t indexEnd = ((size_t)frameWidth * y) + xEnd;
+
+			// Leading odd pixel shares its byte triplet with the previous pixel.
+			if (index & 1)
+			{
+				PixelRaw(rawColor, xStart, y);
+				index++;
+			}
+
+			// Whole pixel pairs are written as a fixed 3 byte pattern.
+			const uint8_t pattern0 = uint8_t(rawColor >> 4);
+			const uint8_t pattern1 = uint8_t(Rgb::B4(rawColor) << 4) | Rgb::R4(rawColor);
+			const uint8_t pattern2 = uint8_t(rawColor);
+			size_t offset = (index >> 1) * 3;
+			for (; index < indexEnd; index += 2)
+			{
+				Buffer[offset++] = pattern0;
+				Buffer[offset++] = pattern1;
+				Buffer[offset++] = pattern2;
+			}
+
+			// Trailing even pixel shares its byte triplet with the next pixel.
+			if (index == indexEnd)
+			{
+				PixelRaw(rawColor, xEnd, y);
+			}
+		}
+
+		void RectangleFillRaw(const color_t rawColor, const pixel_t x1, const pixel_t y1, const pixel_t x2, const pixel_t y2)
+		{
+			for (pixel_t y = y1; y <= y2; y++)
+			{
+				LineHorizontalRaw(rawColor, x1, y, x2);
+			}
+		}
+
+		void FillRaw(const color_t rawColor)
+		{
+			const uint8_t pattern0 = uint8_t(rawColor >> 4);
+			const uint8_t pattern1 = uint8_t(Rgb::B4(rawColor) << 4) | Rgb::R4(rawColor);
+			const uint8_t pattern2 = uint8_t(rawColor);
+
+			size_t offset = 0;
+			for (; offset + 2 < BufferSize; offset += 3)
+			{
+				Buffer[offset] = pattern0;
+				Buffer[offset + 1] = pattern1;
+				Buffer[offset + 2] = pattern2;
+			}
+
+			// Odd pixel count leaves a trailing half triplet.
+			if (offset < BufferSize)
+			{
+				Buffer[offset++] = pattern0;
+				Buffer[offset] = pattern1;
+			}
+		}
+
+		/// <summary>
+		/// Moves whole rows, overlap safe. Requires an even frame width, so rows start on a byte boundary.
+		/// </summary>
+		void MoveRowsRaw(const pixel_t destinationRow, const pixel_t sourceRow, const pixel_t rowCount)
+		{
+			static_assert((frameWidth % 2) == 0, "Rows must start on a byte boundary.");
+			static constexpr size_t rowSize = ((size_t)frameWidth * 3) / 2;
+			memmove(&Buffer[rowSize * destinationRow], &Buffer[rowSize * sourceRow], rowSize * rowCount);
+		}
+
+		template<bool inverted, uint8_t Sections>
+		void ClearRaw(const uint8_t section)
+		{
+			static constexpr size_t sectionSize = BufferSize / Sections;
+			const size_t sectionOffset = sectionSize * section;
+			const size_t size = (section == Sections - 1) ? (BufferSize - sectionOffset) : sectionSize;
+			memset(&Buffer[sectionOffset], inverted ? UINT8_MAX : 0, size);
+		}
+
+	private:
+		color_t GetPixelRaw(const pixel_t x, const pixel_t y) const
+		{
+			const size_t index = ((size_t)frameWidth * y) + x;
+			const size_t offset = (index >> 1) * 3;
+
+			if (index & 1)
+			{
+				return ((color_t)(Buffer[offset + 1] & 0x0F) << 8) | Buffer[offset + 2];
+			}
+			else
+			{
+				return ((color_t)Buffer[offset] << 4) | (Buffer[offset + 1] >> 4);
+			}
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -166,6 +166,39 @@ namespace Egfx
 			}
 		}
 
+		/// <summary>
+		/// Copies a row of raw colors, byte swapped into the big endian buffer.
+		/// </summary>
+		void RowCopyRaw(const color_t* rawColors, const pixel_t x, const pixel_t y, const pixel_t count,
+			const bool keyed, const color_t keyColor)
+		{
+			uint8_t* target = &Buffer[((sizeof(color_t) * frameWidth) * y) + (sizeof(color_t) * x)];
+
+			if (keyed)
+			{
+				for (pixel_t i = 0; i < count; i++)
+				{
+					const color_t rawColor = rawColors[i];
+					if (rawColor != keyColor)
+					{
+						target[0] = uint8_t(rawColor >> 8);
+						target[1] = uint8_t(rawColor);
+					}
+					target += sizeof(color_t);
+				}
+			}
+			else
+			{
+				for (pixel_t i = 0; i < count; i++)
+				{
+					const color_t rawColor = rawColors[i];
+					target[0] = uint8_t(rawColor >> 8);
+					target[1] = uint8_t(rawColor);
+					target += sizeof(color_t);
+				}
+			}
+		}
+
 		void FillRaw(const color_t rawColor)
 		{
 			const uint8_t highColor = rawColor >> 8;
@@ -176,6 +209,15 @@ namespace Egfx
 			}
 		}
 
+		/// <summary>
+		/// Moves whole rows, overlap safe.
+		/// </summary>
+		void MoveRowsRaw(const pixel_t destinationRow, const pixel_t sourceRow, const pixel_t rowCount)
+		{
+			static constexpr size_t rowSize = sizeof(color_t) * frameWidth;
+			memmove(&Buffer[rowSize * destinationRow], &Buffer[rowSize * sourceRow], rowSize * rowCount);
+		}
+
 #if defined(EGFX_PLATFORM_32BIT)
 		template<bool inverted, uint8_t Sections>
 		void ClearRaw(const uint8_t section)
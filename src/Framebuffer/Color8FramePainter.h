@@ -134,6 +134,15 @@ namespace Egfx
 			memset(Buffer, rawColor, BufferSize);
 		}
 
+		/// <summary>
+		/// Moves whole rows, overlap safe.
+		/// </summary>
+		void MoveRowsRaw(const pixel_t destinationRow, const pixel_t sourceRow, const pixel_t rowCount)
+		{
+			static constexpr size_t rowSize = sizeof(color_t) * frameWidth;
+			memmove(&Buffer[rowSize * destinationRow], &Buffer[rowSize * sourceRow], rowSize * rowCount);
+		}
+
 		template<bool inverted, uint8_t Sections>
 		void ClearRaw(const uint8_t section)
 		{
@@ -4,6 +4,7 @@
 #include "BinaryFramePainter.h"
 #include "Color8FramePainter.h"
 #include "Grayscale8FramePainter.h"
+#include "Color12FramePainter.h"
 #include "Color16FramePainter.h"
 #include "Color32FramePainter.h"
 
@@ -73,6 +74,26 @@ namespace Egfx
 		Grayscale8Framebuffer(uint8_t buffer[Base::BufferSize] = nullptr) : Base(buffer) {}
 	};
 
+	/// <summary>
+	/// 12 bit color frame buffer, packed in the 4-4-4 panel wire format.
+	/// </summary>
+	/// <typeparam name="frameWidth">Frame buffer width.</typeparam>
+	/// <typeparam name="frameHeight">Frame buffer height.</typeparam>
+	/// <typeparam name="clearDivisorPower">Frame buffer clear will be divided into sections. The divisor is set by the power of 2, keeping it a multiple of 2.</typeparam>
+	/// <typeparam name="displayOptions">Display configuration options (mirror, rotation, inverted colors, AA).</typeparam>
+	template<uint16_t frameWidth, uint16_t frameHeight
+		, uint8_t clearDivisorPower = 0
+		, typename displayOptions = DisplayOptions::Default>
+	class Color12Framebuffer
+		: public TemplateFramebuffer<Color12FramePainter<frameWidth, frameHeight, displayOptions::HasRotation()>, clearDivisorPower, displayOptions>
+	{
+	private:
+		using Base = TemplateFramebuffer<Color12FramePainter<frameWidth, frameHeight, displayOptions::HasRotation()>, clearDivisorPower, displayOptions>;
+
+	public:
+		Color12Framebuffer(uint8_t buffer[Base::BufferSize] = nullptr) : Base(buffer) {}
+	};
+
 	/// <summary>
 	/// 16 bit color frame buffer.
 	/// </summary>
@@ -17,6 +17,8 @@ namespace Egfx
 
 	protected:
 		using BaseFramebuffer::Buffer;
+		using BaseFramebuffer::BackgroundClear;
+		using BaseFramebuffer::ClearValue;
 
 	protected:
 		// Pointers to the two buffers.
@@ -63,6 +65,37 @@ namespace Egfx
 
 			return true;
 		}
+
+		/// <summary>
+		/// Clears the back buffer, once its push has completed, so the next Flip() can skip the clear.
+		/// Stepped: DMA on RP2040, chunked memset elsewhere.
+		/// </summary>
+		/// <returns>True when done or nothing to do.</returns>
+		virtual bool ClearBackBuffer() override
+		{
+			uint8_t* backBuffer = Buffers[(FrontBufferIndex + 1) & 1];
+
+			if (backBuffer == nullptr)
+			{
+				return true;
+			}
+
+			if (!BackgroundClear.IsBusy())
+			{
+				if (BackgroundClear.GetFilled() == backBuffer)
+				{
+					return true;
+				}
+				BackgroundClear.Start(backBuffer, BufferSize, ClearValue);
+			}
+			else if (BackgroundClear.GetTarget() != backBuffer)
+			{
+				// Front buffer clear in progress, the back buffer is cleared after its Flip().
+				return true;
+			}
+
+			return BackgroundClear.Step();
+		}
 	};
 }
 #endif
\ No newline at end of file
@@ -3,10 +3,7 @@
 
 #include "../Model/RgbColor.h"
 #include "../Model/DisplayOptions.h"
-
-#if defined(ARDUINO_ARCH_RP2040)
-#include "hardware/dma.h"
-#endif
+#include "AsyncBufferFill.h"
 
 namespace Egfx
 {
@@ -56,17 +53,8 @@ namespace Egfx
 
 		using signed_t = TypeTraits::TypeSign::make_signed<pixel_t>::type;
 
-#if defined(ARDUINO_ARCH_RP2040)
-		// Static fill constant lives for the lifetime of the program; safe as DMA source.
-		const uint32_t FillZero32 = 0x00000000u;
-		const uint32_t FillOnes32 = 0xFFFFFFFFu;
-
-		// Async DMA clear state
-		int DmaChan = -1;
-		bool DmaActive = false;
-#else
 		static constexpr uint8_t ClearStepsCount = uint8_t(1) << clearDivisorPower;
-#endif
+		static constexpr uint8_t ClearValue = displayOptions::Inverted ? UINT8_MAX : 0;
 		static constexpr TransformCaseType TransformCase = // Explicitly map each rotation+mirror combination to a named case. C++11 compatible implementation.
 			(displayOptions::Rotation == DisplayOptions::RotationEnum::None) ?
 			((displayOptions::Mirror == DisplayOptions::MirrorEnum::None) ? TransformCaseType::Identity :
@@ -95,12 +83,29 @@ namespace Egfx
 
 		static constexpr color_t ColorMask = static_cast<color_t>((uint64_t(1) << FramePainter::ColorDepth) - 1);
 
+		// Compile-time dispatch: 5-6-5 rows are copied unchanged when the painter is 16 bit, colors are not inverted
+		// and physical rows run in the same direction as logical rows.
+		using RowCopyTag =
+			typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+			IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+			IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+			(FramePainter::ColorDepth == 16) && !FramePainter::Monochrome && !displayOptions::Inverted
+			&& ((TransformCase == TransformCaseType::Identity)
+				|| (TransformCase == TransformCaseType::MirrorY)
+				|| (TransformCase == TransformCaseType::Rotate180MirrorX))>::type;
+
 	protected:
 		using FramePainter::Buffer;
 
+		// Background clear, of this buffer (RP2040 DMA) or of a back buffer after its push.
+		AsyncBufferFill<(BufferSize / ClearStepsCount) + 1> BackgroundClear{};
+
 	private:
 		uint8_t ClearIndex = 0;
 
+		// Fused clear watermark, bytes from the start already cleared for the next frame.
+		size_t ClearedSize = 0;
+
 	public:
 		TemplateFramebuffer(uint8_t buffer[BufferSize] = nullptr)
 			: FramePainter(buffer)
@@ -121,9 +126,41 @@ namespace Egfx
 
 		bool ClearFrameBuffer() final
 		{
+			if (ClearedSize > 0)
+			{
+				// Fused clear during push, only the rest is left.
+				ClearPushed(BufferSize);
+				ClearedSize = 0;
+
+				return true;
+			}
+
+			if (BackgroundClear.GetTarget() == Buffer)
+			{
+				// Background clear of this buffer in progress.
+				if (!BackgroundClear.Step())
+				{
+					return false;
+				}
+				BackgroundClear.Release();
+
+				return true;
+			}
+			else if (BackgroundClear.GetFilled() == Buffer)
+			{
+				// Already cleared in the background.
+				BackgroundClear.Release();
+
+				return true;
+			}
+
 #if defined(ARDUINO_ARCH_RP2040)
-			return AsyncClearBuffer();
-#else
+			// DMA clear, unless the background clear is busy with another buffer.
+			if (ClearIndex == 0 && BackgroundClear.Start(Buffer, BufferSize, ClearValue))
+			{
+				return false;
+			}
+#endif
 			// The template keyword is required in this context to disambiguate between a static method and a template method.
 			FramePainter::template ClearRaw<displayOptions::Inverted, ClearStepsCount>(ClearIndex);
 
@@ -139,12 +176,39 @@ namespace Egfx
 			{
 				return false;
 			}
-#endif
+		}
+
+		/// <summary>
+		/// Starts or steps the background clear of the back buffer, once it has been pushed.
+		/// </summary>
+		/// <returns>True when done. Always true for single buffers.</returns>
+		virtual bool ClearBackBuffer()
+		{
+			return true;
+		}
+
+		/// <summary>
+		/// Fused clear: clears the buffer up to pushedSize, the part the screen driver has already transmitted,
+		/// while the rest is still being pushed. The next ClearFrameBuffer() only clears what is left.
+		/// Single buffer only: the pushed buffer must be the next drawing buffer.
+		/// </summary>
+		/// <param name="pushedSize">Bytes from the start of the buffer released by the screen driver.</param>
+		void ClearPushed(const size_t pushedSize)
+		{
+			if (Buffer != nullptr
+				&& pushedSize > ClearedSize
+				&& pushedSize <= BufferSize)
+			{
+				memset(&Buffer[ClearedSize], ClearValue, pushedSize - ClearedSize);
+				ClearedSize = pushedSize;
+			}
 		}
 
 		virtual void SetBuffer(uint8_t buffer[BufferSize])
 		{
 			Buffer = buffer;
+			ClearedSize = 0;
+			BackgroundClear.Release();
 		}
 
 		inline void Pixel(const rgb_color_t color, const pixel_t x, const pixel_t y) final
@@ -405,6 +469,87 @@ namespace Egfx
 			FramePainter::FillRaw(GetRawColor(color));
 		}
 
+		/// <summary>
+		/// Scrolls the rows between top and bottom (inclusive) by a number of lines, clearing the exposed rows.
+		/// Requires a row-major frame painter and no 90/270-degree rotation.
+		/// </summary>
+		/// <param name="top">First row of the scroll region.</param>
+		/// <param name="bottom">Last row of the scroll region.</param>
+		/// <param name="lines">Positive moves content up, negative moves content down.</param>
+		void ScrollRegion(const pixel_t top, const pixel_t bottom, const int16_t lines)
+		{
+			static_assert(!AxisSwapped, "Scroll region rows must be physical rows.");
+
+			const pixel_t regionTop = MaxValue<pixel_t>(0, MinValue(top, bottom));
+			const pixel_t regionBottom = MinValue<pixel_t>(FrameHeight - 1, MaxValue(top, bottom));
+			if (regionTop > regionBottom || lines == 0)
+			{
+				return;
+			}
+
+			// Mirrored rows scroll the opposite way in physical memory.
+			const pixel_t y1 = TransformCoordinates({ 0, regionTop }).y;
+			const pixel_t y2 = TransformCoordinates({ 0, regionBottom }).y;
+			const pixel_t physicalTop = MinValue(y1, y2);
+			const pixel_t physicalBottom = MaxValue(y1, y2);
+			const int16_t physicalLines = (y1 <= y2) ? lines : -lines;
+
+			const pixel_t height = physicalBottom - physicalTop + 1;
+			const pixel_t shift = (pixel_t)MinValue<int16_t>(height, AbsValue(physicalLines));
+			const color_t clearColor = displayOptions::Inverted ? ColorMask : 0;
+
+			if (physicalLines > 0)
+			{
+				if (shift < height)
+				{
+					FramePainter::MoveRowsRaw(physicalTop, physicalTop + shift, height - shift);
+				}
+				FramePainter::RectangleFillRaw(clearColor, 0, physicalBottom - shift + 1, FramePainter::PhysicalWidth - 1, physicalBottom);
+			}
+			else
+			{
+				if (shift < height)
+				{
+					FramePainter::MoveRowsRaw(physicalTop + shift, physicalTop, height - shift);
+				}
+				FramePainter::RectangleFillRaw(clearColor, 0, physicalTop, FramePainter::PhysicalWidth - 1, physicalTop + shift - 1);
+			}
+		}
+
+		bool RowCopy565(const uint16_t* colors, const pixel_t x, const pixel_t y, const pixel_t count,
+			const bool keyed, const uint16_t keyColor) final
+		{
+			return RowCopy565(colors, x, y, count, keyed, keyColor, RowCopyTag{});
+		}
+
+	private:
+		bool RowCopy565(const uint16_t* colors, const pixel_t x, const pixel_t y, const pixel_t count,
+			const bool keyed, const uint16_t keyColor, IntegerSignal::TypeTraits::TypeDispatch::TrueType)
+		{
+			if (y < 0 || y >= FrameHeight
+				|| count <= 0
+				|| x >= FrameWidth
+				|| (static_cast<int32_t>(x) + count) <= 0)
+			{
+				return true;
+			}
+
+			// Clip to framebuffer bounds to keep raw painters in-range.
+			const pixel_t skip = (x < 0) ? static_cast<pixel_t>(-x) : 0;
+			const pixel_t last = MinValue<int32_t>(count - 1, static_cast<int32_t>(FrameWidth) - 1 - x);
+
+			const pixel_point_t start = TransformCoordinates({ static_cast<pixel_t>(x + skip), y });
+			FramePainter::RowCopyRaw(&colors[skip], start.x, start.y, last - skip + 1, keyed, keyColor);
+
+			return true;
+		}
+
+		bool RowCopy565(const uint16_t*, const pixel_t, const pixel_t, const pixel_t,
+			const bool, const uint16_t, IntegerSignal::TypeTraits::TypeDispatch::FalseType)
+		{
+			return false;
+		}
+
 	private:
 		/// <summary>
 		/// Draws a diagonal line between two points using Bresenham's algorithm, selecting the optimal direction based on the line's slope.
@@ -572,93 +717,6 @@ namespace Egfx
 			}
 		}
 
-#if defined(ARDUINO_ARCH_RP2040)
-	private:
-		bool AsyncClearBuffer()
-		{
-			if (Buffer == nullptr || BufferSize == 0)
-				return true;
-
-			if (!DmaActive)
-			{
-				// Align destination to 32-bit boundary: pre-clear leading bytes until aligned.
-				uint8_t* dest = Buffer;
-				size_t remaining = BufferSize;
-
-				// Pre-align to 4-byte boundary with byte memset.
-				while (((reinterpret_cast<uintptr_t>(dest) & 0x3u) != 0) && remaining > 0)
-				{
-					*dest++ = displayOptions::Inverted ? UINT8_MAX : 0;
-					remaining--;
-				}
-
-				// Compute word count for aligned body and leave any tail bytes for after DMA.
-				const size_t wordCount = remaining / sizeof(uint32_t);
-
-				DmaChan = dma_claim_unused_channel(true);
-				dma_channel_config cfg = dma_channel_get_default_config(DmaChan);
-				channel_config_set_read_increment(&cfg, false);
-				channel_config_set_write_increment(&cfg, true);
-				channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
-
-				if (wordCount > 0)
-				{
-					dma_channel_configure(
-						DmaChan,
-						&cfg,
-						reinterpret_cast<uint32_t*>(dest), // aligned destination
-						displayOptions::Inverted ? &FillOnes32 : &FillZero32, // static source constant
-						wordCount,                          // number of 32-bit words
-						true                                // start immediately
-					);
-					DmaActive = true;
-					return false; // DMA in progress
-				}
-				else
-				{
-					// No aligned words; clear any remaining tail bytes now.
-					if (remaining)
-					{
-						memset(dest, displayOptions::Inverted ? UINT8_MAX : 0, remaining);
-					}
-					return true;
-				}
-			}
-
-			// Poll DMA completion.
-			if (dma_channel_is_busy(DmaChan))
-			{
-				return false;
-			}
-
-			// DMA complete: clear any tail bytes (remaining % 4).
-			// Recompute aligned region to find tail safely.
-			uint8_t* destAlignedStart = Buffer;
-			size_t remaining = BufferSize;
-
-			while (((reinterpret_cast<uintptr_t>(destAlignedStart) & 0x3u) != 0) && remaining > 0)
-			{
-				// already byte-cleared in start phase
-				destAlignedStart++;
-				remaining--;
-			}
-
-			const size_t alignedBytes = (remaining / sizeof(uint32_t)) * sizeof(uint32_t);
-			uint8_t* tail = destAlignedStart + alignedBytes;
-			const size_t tailBytes = remaining - alignedBytes;
-
-			if (tailBytes)
-			{
-				memset(tail, displayOptions::Inverted ? UINT8_MAX : 0, tailBytes);
-			}
-
-			dma_channel_unclaim(DmaChan);
-			DmaChan = -1;
-			DmaActive = false;
-
-			return true;
-		}
-#endif
 	};
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,424 @@
+#ifndef _EGFX_FRAMEWORK_ASSETS_BITMAP_AFFINE_DRAWER_h
+#define _EGFX_FRAMEWORK_ASSETS_BITMAP_AFFINE_DRAWER_h
+
+#include <EgfxFramework.h>
+#include <IntegerTrigonometry16.h>
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Assets
+		{
+			namespace Bitmap
+			{
+				/// <summary>
+				/// Affine sprite drawer: rotation, non-integer scale and X shear in a single pass.
+				///
+				/// Walks the destination rows of the transformed bounding box and inverse-maps each row into the source,
+				/// with 16.16 fixed-point stepping. Each row is first narrowed to the exact run of pixels that land inside the source,
+				/// so every destination pixel is written once, without gaps.
+				/// Nearest sampling by default. Bilinear sampling applies to RGB565 bitmaps only, other formats sample nearest.
+				///
+				/// The pivot is a source-space point, drawn at the Draw() position.
+				/// Scale and shear are 8.8 fixed-point, ScaleUnit is 1x.
+				/// </summary>
+				/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+				/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+				/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+				/// <typeparam name="BitmapReader">Bitmap reader type providing ReadColorAt(...).</typeparam>
+				/// <typeparam name="TransparentColor">Transparent key color (RGB888).</typeparam>
+				/// <typeparam name="UseTransparentColor">Enables transparent key color skipping when true.</typeparam>
+				/// <typeparam name="ColorShaderType">Color shader type providing Shade(color).</typeparam>
+				/// <typeparam name="Bilinear">Enables bilinear sampling of RGB565 bitmaps.</typeparam>
+				template<typename dimension_t,
+					dimension_t Width,
+					dimension_t Height,
+					typename BitmapReader = Framework::Bitmap::Reader::Flash,
+					rgb_color_t TransparentColor = RGB_COLOR_BLACK,
+					bool UseTransparentColor = false,
+					typename ColorShaderType = Framework::Shader::Color::NoShader<dimension_t>,
+					bool Bilinear = false
+				>
+				class AffineDrawer : public Framework::Shader::Pixel::ClipRectangle
+				{
+				public:
+					/// <summary>8.8 fixed-point unit for scale and shear.</summary>
+					static constexpr uint16_t ScaleUnit = 256;
+
+				private:
+					static_assert(Width > 0 && Height > 0, "AffineDrawer requires a non-empty bitmap.");
+					static_assert(Width <= 4096 && Height <= 4096, "AffineDrawer bitmap dimensions must fit 16.16 fixed-point stepping.");
+
+					static constexpr uint8_t FixedShift = 16;
+					static constexpr int32_t FixedHalf = int32_t(1) << (FixedShift - 1);
+					static constexpr int32_t WidthFixed = static_cast<int32_t>(Width) << FixedShift;
+					static constexpr int32_t HeightFixed = static_cast<int32_t>(Height) << FixedShift;
+
+					// Compile-time dispatch: bilinear sampling for RGB565 bitmaps.
+					using BilinearTag =
+						typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+						IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+						IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+						Bilinear>::type;
+
+				public:
+					/// <summary>Color shader applied to each sampled bitmap pixel.</summary>
+					ColorShaderType ColorShader{};
+
+				private:
+					// Inverse matrix, destination to source (16.16).
+					int32_t InverseXX = int32_t(1) << FixedShift;
+					int32_t InverseXY = 0;
+					int32_t InverseYX = 0;
+					int32_t InverseYY = int32_t(1) << FixedShift;
+
+					// Source-space pivot (16.16).
+					int32_t PivotX = WidthFixed / 2;
+					int32_t PivotY = HeightFixed / 2;
+
+					// Destination bounding box, relative to the Draw() position (pixels).
+					int16_t BoundsX1 = 0;
+					int16_t BoundsY1 = 0;
+					int16_t BoundsX2 = 0;
+					int16_t BoundsY2 = 0;
+
+					angle_t Angle = 0;
+					uint16_t ScaleX = ScaleUnit;
+					uint16_t ScaleY = ScaleUnit;
+					int16_t ShearX = 0;
+
+				public:
+					AffineDrawer()
+					{
+						UpdateMatrix();
+					}
+
+					~AffineDrawer() = default;
+
+					void SetRotation(const angle_t angle)
+					{
+						Angle = angle;
+						UpdateMatrix();
+					}
+
+					angle_t GetRotation() const
+					{
+						return Angle;
+					}
+
+					/// <summary>
+					/// Sets the scale, 8.8 fixed-point (ScaleUnit is 1x). Zero is raised to the smallest step.
+					/// </summary>
+					void SetScale(const uint16_t scaleX, const uint16_t scaleY)
+					{
+						ScaleX = MaxValue<uint16_t>(scaleX, 1);
+						ScaleY = MaxValue<uint16_t>(scaleY, 1);
+						UpdateMatrix();
+					}
+
+					void SetScale(const uint16_t scale)
+					{
+						SetScale(scale, scale);
+					}
+
+					/// <summary>
+					/// Sets the X shear, 8.8 fixed-point pixels of X offset per pixel of Y, applied before rotation.
+					/// </summary>
+					void SetShearX(const int16_t shear)
+					{
+						ShearX = shear;
+						UpdateMatrix();
+					}
+
+					/// <summary>
+					/// Sets the source-space pivot point, drawn at the Draw() position. Defaults to the bitmap center.
+					/// </summary>
+					void SetPivot(const dimension_t x, const dimension_t y)
+					{
+						PivotX = static_cast<int32_t>(x) << FixedShift;
+						PivotY = static_cast<int32_t>(y) << FixedShift;
+						UpdateMatrix();
+					}
+
+					/// <summary>
+					/// Sets the rotation, scale and shear at once, with a single matrix update.
+					/// </summary>
+					void SetTransform(const angle_t angle, const uint16_t scaleX, const uint16_t scaleY, const int16_t shearX = 0)
+					{
+						Angle = angle;
+						ScaleX = MaxValue<uint16_t>(scaleX, 1);
+						ScaleY = MaxValue<uint16_t>(scaleY, 1);
+						ShearX = shearX;
+						UpdateMatrix();
+					}
+
+					/// <summary>
+					/// Draws an 8-bit bitmap (indexed/paletted or Color332, depending on usage).
+					/// </summary>
+					/// <param name="framebuffer">Target framebuffer to draw into.</param>
+					/// <param name="x">Pixel-space position of the pivot.</param>
+					/// <param name="y">Pixel-space position of the pivot.</param>
+					/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+					void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* bitmap)
+					{
+						static constexpr uint8_t TransparentColor8 =
+							Rgb::Color332From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+						DrawRows(framebuffer, x, y, bitmap, TransparentColor8, TypeTraits::TypeDispatch::FalseType{});
+					}
+
+					/// <summary>
+					/// Draws a 16-bit bitmap (RGB565), with optional bilinear sampling.
+					/// </summary>
+					/// <param name="framebuffer">Target framebuffer to draw into.</param>
+					/// <param name="x">Pixel-space position of the pivot.</param>
+					/// <param name="y">Pixel-space position of the pivot.</param>
+					/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+					void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint16_t* bitmap)
+					{
+						static constexpr uint16_t TransparentColor16 =
+							Rgb::Color565From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+						DrawRows(framebuffer, x, y, bitmap, TransparentColor16, BilinearTag{});
+					}
+
+					/// <summary>
+					/// Draws a 32-bit bitmap (RGB888 or ARGB8888, depending on usage).
+					/// </summary>
+					/// <param name="framebuffer">Target framebuffer to draw into.</param>
+					/// <param name="x">Pixel-space position of the pivot.</param>
+					/// <param name="y">Pixel-space position of the pivot.</param>
+					/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+					void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint32_t* bitmap)
+					{
+						static constexpr uint32_t TransparentColor32 =
+							Rgb::Color888From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+						DrawRows(framebuffer, x, y, bitmap, TransparentColor32, TypeTraits::TypeDispatch::FalseType{});
+					}
+
+				private:
+					template<typename bitmap_color_t, typename SamplingTag>
+					void DrawRows(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y,
+						const bitmap_color_t* bitmap, const bitmap_color_t transparentColor, SamplingTag samplingTag)
+					{
+						// Bounding box in pixel-space, limited to the clip rectangle.
+						const pixel_rectangle_t clip = GetClip();
+						const int32_t x1 = MaxValue<int32_t>(static_cast<int32_t>(x) + BoundsX1, clip.topLeft.x);
+						const int32_t y1 = MaxValue<int32_t>(static_cast<int32_t>(y) + BoundsY1, clip.topLeft.y);
+						const int32_t x2 = MinValue<int32_t>(static_cast<int32_t>(x) + BoundsX2, clip.bottomRight.x);
+						const int32_t y2 = MinValue<int32_t>(static_cast<int32_t>(y) + BoundsY2, clip.bottomRight.y);
+						if (x1 > x2 || y1 > y2)
+						{
+							return;
+						}
+
+						// Source coordinates of the first pixel center, then stepped per row and per column.
+						const int64_t relativeX = (static_cast<int64_t>(x1 - x) << FixedShift) + FixedHalf;
+						const int64_t relativeY = (static_cast<int64_t>(y1 - y) << FixedShift) + FixedHalf;
+						int32_t rowU = static_cast<int32_t>(((InverseXX * relativeX) + (InverseXY * relativeY)) >> FixedShift) + PivotX;
+						int32_t rowV = static_cast<int32_t>(((InverseYX * relativeX) + (InverseYY * relativeY)) >> FixedShift) + PivotY;
+
+						for (int32_t row = y1; row <= y2; row++)
+						{
+							int32_t first = 0;
+							int32_t last = x2 - x1;
+							if (NarrowSpan(rowU, InverseXX, WidthFixed, first, last)
+								&& NarrowSpan(rowV, InverseYX, HeightFixed, first, last))
+							{
+								int32_t u = rowU + (first * InverseXX);
+								int32_t v = rowV + (first * InverseYX);
+								for (int32_t column = x1 + first; column <= x1 + last; column++)
+								{
+									bitmap_color_t color;
+									if (Sample(bitmap, u, v, transparentColor, color, samplingTag))
+									{
+										framebuffer->Pixel(ColorShader.Shade(Framework::Bitmap::ToColor(color)),
+											static_cast<pixel_t>(column),
+											static_cast<pixel_t>(row));
+									}
+									u += InverseXX;
+									v += InverseYX;
+								}
+							}
+
+							rowU += InverseXY;
+							rowV += InverseYY;
+						}
+					}
+
+					/// <summary>
+					/// Nearest sample. False if transparent.
+					/// </summary>
+					template<typename bitmap_color_t>
+					static bool Sample(const bitmap_color_t* bitmap, const int32_t u, const int32_t v,
+						const bitmap_color_t transparentColor, bitmap_color_t& color, TypeTraits::TypeDispatch::FalseType)
+					{
+						color = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap,
+							static_cast<dimension_t>(u >> FixedShift),
+							static_cast<dimension_t>(v >> FixedShift));
+
+						return !UseTransparentColor || (color != transparentColor);
+					}
+
+					/// <summary>
+					/// Bilinear RGB565 sample, clamped to the bitmap edges. False if the nearest source pixel is transparent.
+					/// Transparent taps take the nearest color, so the key color never bleeds into the edges.
+					/// </summary>
+					static bool Sample(const uint16_t* bitmap, const int32_t u, const int32_t v,
+						const uint16_t transparentColor, uint16_t& color, TypeTraits::TypeDispatch::TrueType)
+					{
+						const uint16_t nearest = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap,
+							static_cast<dimension_t>(u >> FixedShift),
+							static_cast<dimension_t>(v >> FixedShift));
+
+						if (UseTransparentColor && (nearest == transparentColor))
+						{
+							return false;
+						}
+
+						// Taps around the sample point, relative to the pixel centers.
+						const int32_t sampleU = u - FixedHalf;
+						const int32_t sampleV = v - FixedHalf;
+						int32_t column = sampleU >> FixedShift;
+						int32_t row = sampleV >> FixedShift;
+						uint8_t weightX = static_cast<uint8_t>(sampleU >> (FixedShift - 8));
+						uint8_t weightY = static_cast<uint8_t>(sampleV >> (FixedShift - 8));
+						if (column < 0)
+						{
+							column = 0;
+							weightX = 0;
+						}
+						if (row < 0)
+						{
+							row = 0;
+							weightY = 0;
+						}
+						const int32_t nextColumn = MinValue<int32_t>(column + 1, Width - 1);
+						const int32_t nextRow = MinValue<int32_t>(row + 1, Height - 1);
+
+						const uint16_t topLeft = ReadTap(bitmap, column, row, nearest, transparentColor);
+						const uint16_t topRight = ReadTap(bitmap, nextColumn, row, nearest, transparentColor);
+						const uint16_t bottomLeft = ReadTap(bitmap, column, nextRow, nearest, transparentColor);
+						const uint16_t bottomRight = ReadTap(bitmap, nextColumn, nextRow, nearest, transparentColor);
+
+						color = static_cast<uint16_t>(
+							(Interpolate(topLeft >> 11, topRight >> 11, bottomLeft >> 11, bottomRight >> 11, weightX, weightY) << 11)
+							| (Interpolate((topLeft >> 5) & 0x3F, (topRight >> 5) & 0x3F, (bottomLeft >> 5) & 0x3F, (bottomRight >> 5) & 0x3F, weightX, weightY) << 5)
+							| Interpolate(topLeft & 0x1F, topRight & 0x1F, bottomLeft & 0x1F, bottomRight & 0x1F, weightX, weightY));
+
+						return true;
+					}
+
+					static uint16_t ReadTap(const uint16_t* bitmap, const int32_t column, const int32_t row,
+						const uint16_t nearest, const uint16_t transparentColor)
+					{
+						const uint16_t tap = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap,
+							static_cast<dimension_t>(column),
+							static_cast<dimension_t>(row));
+
+						return (UseTransparentColor && (tap == transparentColor)) ? nearest : tap;
+					}
+
+					/// <summary>
+					/// Bilinear blend of a single channel, weights in 1/256.
+					/// </summary>
+					static uint16_t Interpolate(const uint16_t topLeft, const uint16_t topRight,
+						const uint16_t bottomLeft, const uint16_t bottomRight,
+						const uint8_t weightX, const uint8_t weightY)
+					{
+						const int32_t top = (static_cast<int32_t>(topLeft) << 8) + ((static_cast<int32_t>(topRight) - topLeft) * weightX);
+						const int32_t bottom = (static_cast<int32_t>(bottomLeft) << 8) + ((static_cast<int32_t>(bottomRight) - bottomLeft) * weightX);
+
+						return static_cast<uint16_t>(((top << 8) + ((bottom - top) * weightY) + (int32_t(1) << 15)) >> 16);
+					}
+
+					/// <summary>
+					/// Narrows the step range [first, last] to the steps where 0 &lt;= start + (step * t) &lt; limit.
+					/// </summary>
+					/// <returns>False if no step is left.</returns>
+					static bool NarrowSpan(const int32_t start, const int32_t step, const int32_t limit, int32_t& first, int32_t& last)
+					{
+						int32_t low, high;
+						if (step > 0)
+						{
+							if (start >= limit)
+							{
+								return false;
+							}
+							low = (start >= 0) ? 0 : ((-start + step - 1) / step);
+							high = (limit - 1 - start) / step;
+						}
+						else if (step < 0)
+						{
+							if (start < 0)
+							{
+								return false;
+							}
+							low = (start < limit) ? 0 : ((start - (limit - 1) - step - 1) / -step);
+							high = start / -step;
+						}
+						else
+						{
+							return start >= 0 && start < limit;
+						}
+
+						first = MaxValue(first, low);
+						last = MinValue(last, high);
+
+						return first <= last;
+					}
+
+					/// <summary>
+					/// Rebuilds the inverse matrix and the destination bounding box.
+					/// Forward: destination = Rotate * Scale * Shear * (source - pivot).
+					/// </summary>
+					void UpdateMatrix()
+					{
+						const int64_t cosine = Fraction<int32_t>(Sine16(static_cast<angle_t>(Angle + Trigonometry::ANGLE_90)), int32_t(1) << FixedShift);
+						const int64_t sine = Fraction<int32_t>(Sine16(Angle), int32_t(1) << FixedShift);
+
+						// Inverse: Shear^-1 * Scale^-1 * Rotate^-1.
+						InverseXX = static_cast<int32_t>(((cosine * ScaleUnit) / ScaleX) + ((sine * ShearX) / ScaleY));
+						InverseXY = static_cast<int32_t>(((sine * ScaleUnit) / ScaleX) - ((cosine * ShearX) / ScaleY));
+						InverseYX = static_cast<int32_t>(-(sine * ScaleUnit) / ScaleY);
+						InverseYY = static_cast<int32_t>((cosine * ScaleUnit) / ScaleY);
+
+						// Forward matrix for the corners (16.16).
+						const int64_t forwardXX = (cosine * ScaleX) / ScaleUnit;
+						const int64_t forwardXY = ((cosine * ScaleX * ShearX) / (int32_t(ScaleUnit) * ScaleUnit)) - ((sine * ScaleY) / ScaleUnit);
+						const int64_t forwardYX = (sine * ScaleX) / ScaleUnit;
+						const int64_t forwardYY = ((sine * ScaleX * ShearX) / (int32_t(ScaleUnit) * ScaleUnit)) + ((cosine * ScaleY) / ScaleUnit);
+
+						int64_t minX = INT64_MAX, minY = INT64_MAX, maxX = INT64_MIN, maxY = INT64_MIN;
+						for (uint8_t corner = 0; corner < 4; corner++)
+						{
+							const int64_t cornerX = (((corner & 1) != 0) ? int64_t(WidthFixed) : 0) - PivotX;
+							const int64_t cornerY = (((corner & 2) != 0) ? int64_t(HeightFixed) : 0) - PivotY;
+							const int64_t destinationX = ((forwardXX * cornerX) + (forwardXY * cornerY)) >> FixedShift;
+							const int64_t destinationY = ((forwardYX * cornerX) + (forwardYY * cornerY)) >> FixedShift;
+
+							minX = MinValue(minX, destinationX);
+							minY = MinValue(minY, destinationY);
+							maxX = MaxValue(maxX, destinationX);
+							maxY = MaxValue(maxY, destinationY);
+						}
+
+						// One pixel margin for fixed-point rounding, rows are narrowed exactly when drawing.
+						BoundsX1 = ToBounds((minX >> FixedShift) - 1);
+						BoundsY1 = ToBounds((minY >> FixedShift) - 1);
+						BoundsX2 = ToBounds((maxX >> FixedShift) + 1);
+						BoundsY2 = ToBounds((maxY >> FixedShift) + 1);
+					}
+
+					static int16_t ToBounds(const int64_t value)
+					{
+						return static_cast<int16_t>(MaxValue<int64_t>(INT16_MIN, MinValue<int64_t>(value, INT16_MAX)));
+					}
+				};
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
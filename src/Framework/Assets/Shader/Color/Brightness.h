@@ -121,7 +121,7 @@ namespace Egfx
 							if (Shift > 0)
 							{
 #if defined(EGFX_PLATFORM_HDR)
-								return Rgb::Color888(
+								return Rgb::Color(
 									LimitedAdd<UINT8_MAX>(Rgb::R(baseColor)),
 									LimitedAdd<UINT8_MAX>(Rgb::G(baseColor)),
 									LimitedAdd<UINT8_MAX>(Rgb::B(baseColor)));
@@ -135,17 +135,21 @@ namespace Egfx
 							else if (Shift < 0)
 							{
 #if defined(EGFX_PLATFORM_HDR)
-								return Rgb::Color888(
+								return Rgb::Color(
 									LimitedSubtract(Rgb::R(baseColor)),
 									LimitedSubtract(Rgb::G(baseColor)),
 									LimitedSubtract(Rgb::B(baseColor)));
 #else
-								return Rgb::Color888(
+								return Rgb::Color565From565(
 									LimitedSubtract(Rgb::R5(baseColor)),
 									LimitedSubtract(Rgb::G6(baseColor)),
 									LimitedSubtract(Rgb::B5(baseColor)));
 #endif
 							}
+							else
+							{
+								return baseColor;
+							}
 						}
 
 					private:
@@ -0,0 +1,99 @@
+#ifndef _EGFX_FRAMEWORK_ASSETS_SHADER_COLOR_CHANNEL_LUT_h
+#define _EGFX_FRAMEWORK_ASSETS_SHADER_COLOR_CHANNEL_LUT_h
+
+#include <EgfxFramework.h>
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Assets
+		{
+			namespace Shader
+			{
+				namespace Color
+				{
+					using namespace Framework::Shader::Color;
+
+					/// <summary>
+					/// Fuses a chain of per-channel color shaders into one lookup per channel.
+					/// Configure the chain through its inherited setters, then call UpdateTable() once before drawing.
+					/// HDR: 3x256 bytes. 5-6-5: 32+64+32 bytes, indexed by native components.
+					/// Only for chains where each output channel depends on its input channel alone (Brightness, LightenDarken, Contrast, Invert).
+					/// Channel mixing shaders (Saturation) can wrap this shader instead, as its Base.
+					/// </summary>
+					/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+					/// <typeparam name="Chain">The chained color shader to fuse.</typeparam>
+					template<typename dimension_t,
+						typename Chain = BaseShader<dimension_t>
+					>
+					class ChannelLut : public Chain
+					{
+					private:
+#if defined(EGFX_PLATFORM_HDR)
+						static constexpr uint16_t SizeR = 256;
+						static constexpr uint16_t SizeG = 256;
+						static constexpr uint16_t SizeB = 256;
+#else
+						static constexpr uint16_t SizeR = 32;
+						static constexpr uint16_t SizeG = 64;
+						static constexpr uint16_t SizeB = 32;
+#endif
+
+					private:
+						uint8_t TableR[SizeR];
+						uint8_t TableG[SizeG];
+						uint8_t TableB[SizeB];
+
+					public:
+						ChannelLut() : Chain()
+						{
+							UpdateTable();
+						}
+
+						~ChannelLut() {}
+
+						/// <summary>
+						/// Evaluates the chain once per channel value.
+						/// Call after changing the chain's parameters, at most once per frame.
+						/// </summary>
+						void UpdateTable()
+						{
+#if defined(EGFX_PLATFORM_HDR)
+							for (uint16_t i = 0; i < SizeG; i++)
+							{
+								const rgb_color_t color = Chain::Shade(Rgb::Color(uint8_t(i), uint8_t(i), uint8_t(i)));
+								TableR[i] = Rgb::R(color);
+								TableG[i] = Rgb::G(color);
+								TableB[i] = Rgb::B(color);
+							}
+#else
+							// Green has the most levels, red and blue take every other step.
+							for (uint8_t i = 0; i < SizeG; i++)
+							{
+								const rgb_color_t color = Chain::Shade(Rgb::Color565From565(i >> 1, i, i >> 1));
+								TableG[i] = Rgb::G6(color);
+								if ((i & 1) == 0)
+								{
+									TableR[i >> 1] = Rgb::R5(color);
+									TableB[i >> 1] = Rgb::B5(color);
+								}
+							}
+#endif
+						}
+
+						rgb_color_t Shade(const rgb_color_t color) const
+						{
+#if defined(EGFX_PLATFORM_HDR)
+							return Rgb::Color(TableR[Rgb::R(color)], TableG[Rgb::G(color)], TableB[Rgb::B(color)]);
+#else
+							return Rgb::Color565From565(TableR[Rgb::R5(color)], TableG[Rgb::G6(color)], TableB[Rgb::B5(color)]);
+#endif
+						}
+					};
+				}
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -28,7 +28,7 @@ namespace Egfx
 						static constexpr uint8_t MaxContrastRatio = 6;
 
 					private:
-						int8_t Contrast = 0;
+						int8_t Level = 0;
 						uint8_t Center = INT8_MAX;
 
 					public:
@@ -41,10 +41,10 @@ namespace Egfx
 						/// <param name="contrast">[INT8_MIN+1, -1] Scales down to 0x. [1;INT8_MAX] Scales up to MaxContrastRatio = 4x.</param>
 						void SetContrast(const int8_t contrast)
 						{
-							Contrast = contrast;
-							if (Contrast == INT8_MIN)
+							Level = contrast;
+							if (Level == INT8_MIN)
 							{
-								Contrast = INT8_MIN + 1;
+								Level = INT8_MIN + 1;
 							}
 						}
 
@@ -55,24 +55,24 @@ namespace Egfx
 
 						rgb_color_t Shade(const rgb_color_t color) const
 						{
-							if (Contrast == 0)
+							if (Level == 0)
 							{
 								return Base::Shade(color);
 							}
 							else
 							{
 								rgb_color_t baseColor = Base::Shade(color);
-								if (Contrast > 0)
+								if (Level > 0)
 								{
-									return Rgb::Color(ConstrastUp(Rgb::R(baseColor), Contrast)
-										, ConstrastUp(Rgb::G(baseColor), Contrast)
-										, ConstrastUp(Rgb::B(baseColor), Contrast));
+									return Rgb::Color(ConstrastUp(Rgb::R(baseColor), Level)
+										, ConstrastUp(Rgb::G(baseColor), Level)
+										, ConstrastUp(Rgb::B(baseColor), Level));
 								}
 								else
 								{
-									return Rgb::Color(ConstrastDown(Rgb::R(baseColor), -Contrast)
-										, ConstrastDown(Rgb::G(baseColor), -Contrast)
-										, ConstrastDown(Rgb::B(baseColor), -Contrast));
+									return Rgb::Color(ConstrastDown(Rgb::R(baseColor), -Level)
+										, ConstrastDown(Rgb::G(baseColor), -Level)
+										, ConstrastDown(Rgb::B(baseColor), -Level));
 								}
 							}
 						}
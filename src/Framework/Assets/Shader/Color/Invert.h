@@ -23,11 +23,11 @@ namespace Egfx
 					template<typename dimension_t,
 						typename Base = BaseShader<dimension_t>
 					>
-					struct Invert : BaseShader<dimension_t>
+					struct Invert : Base
 					{
-						rgb_color_t Shade(const rgb_color_t color)
+						rgb_color_t Shade(const rgb_color_t color) const
 						{
-							return ~BaseShader<dimension_t>::Shade(color);
+							return ~Base::Shade(color);
 						}
 					};
 				}
@@ -23,6 +23,11 @@ namespace Egfx
 					private:
 						static constexpr dimension_t MaxSplit = TypeTraits::TypeLimits::type_limits<dimension_t>::Max();
 
+						using span_t = typename TypeTraits::TypeNext::next_int_type<dimension_t>::type;
+
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t Color1 = RGB_COLOR_WHITE;
 						rgb_color_t Color2 = RGB_COLOR_BLACK;
@@ -30,6 +35,9 @@ namespace Egfx
 					private:
 						dimension_t Split = MaxSplit;
 
+						// Span pixels left before the split.
+						span_t SpanCount = 0;
+
 					public:
 						AxisSplitX() = default;
 						~AxisSplitX() = default;
@@ -50,6 +58,23 @@ namespace Egfx
 								return Color2;
 							}
 						}
+
+						void SpanStart(const dimension_t x, const dimension_t /*y*/)
+						{
+							SpanCount = (x < Split) ? (static_cast<span_t>(Split) - x) : 0;
+						}
+
+						rgb_color_t SpanNext()
+						{
+							if (SpanCount > 0)
+							{
+								SpanCount--;
+
+								return Color1;
+							}
+
+							return Color2;
+						}
 					};
 
 					/// <summary>
@@ -62,6 +87,9 @@ namespace Egfx
 					private:
 						static constexpr dimension_t MaxSplit = TypeTraits::TypeLimits::type_limits<dimension_t>::Max();
 
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t Color1 = RGB_COLOR_WHITE;
 						rgb_color_t Color2 = RGB_COLOR_BLACK;
@@ -69,6 +97,9 @@ namespace Egfx
 					private:
 						dimension_t Split = MaxSplit;
 
+						// Constant along a span.
+						rgb_color_t SpanColor = RGB_COLOR_BLACK;
+
 					public:
 						AxisSplitY() = default;
 						~AxisSplitY() = default;
@@ -89,6 +120,16 @@ namespace Egfx
 								return Color2;
 							}
 						}
+
+						void SpanStart(const dimension_t x, const dimension_t y)
+						{
+							SpanColor = Source(x, y);
+						}
+
+						rgb_color_t SpanNext()
+						{
+							return SpanColor;
+						}
 					};
 				}
 			}
@@ -21,6 +21,9 @@ namespace Egfx
 					template<typename dimension_t>
 					class Checkerboard
 					{
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t Color1 = RGB_COLOR_WHITE;
 						rgb_color_t Color2 = RGB_COLOR_BLACK;
@@ -28,6 +31,9 @@ namespace Egfx
 					private:
 						uint8_t Offset = 0;
 
+						// Span phase, true when the next pixel is Color1.
+						bool SpanEven = true;
+
 					protected:
 						pixel_point_t Origin{ 0, 0 };
 
@@ -43,6 +49,22 @@ namespace Egfx
 							return (((globalX + globalY + Offset) % 2) == 0) ? Color1 : Color2;
 						}
 
+						void SpanStart(const dimension_t x, const dimension_t y)
+						{
+							const pixel_t globalX = Origin.x + x;
+							const pixel_t globalY = Origin.y + y;
+
+							SpanEven = ((globalX + globalY + Offset) % 2) == 0;
+						}
+
+						rgb_color_t SpanNext()
+						{
+							const bool even = SpanEven;
+							SpanEven = !SpanEven;
+
+							return even ? Color1 : Color2;
+						}
+
 						/// <summary>
 						/// Pattern phase/shift.
 						/// </summary>
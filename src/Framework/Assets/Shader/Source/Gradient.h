@@ -13,6 +13,149 @@ namespace Egfx
 			{
 				namespace Source
 				{
+					/// <summary>
+					/// Incremental gamma-correct color interpolation along a horizontal span, for the gradient sources.
+					/// Each channel's squared value is stepped linearly (DDA) and its square root is tracked incrementally,
+					/// so there is no division or square root per pixel.
+					/// </summary>
+					class GradientSpan
+					{
+					private:
+						struct Channel
+						{
+							// Squared channel value, 8 bit fixed point.
+							int32_t Power;
+							int32_t Step;
+
+							// Current channel value and its square.
+							uint16_t ValuePow;
+							uint8_t Value;
+
+							void Start(const uint16_t fromPow, const uint16_t toPow, const uint16_t position, const uint16_t length)
+							{
+								Step = (length > 0) ? ((static_cast<int32_t>(toPow) - fromPow) * 256) / length : 0;
+								Power = (static_cast<int32_t>(fromPow) * 256) + (Step * position);
+								Value = Rgb::GammaEncode(static_cast<uint16_t>(Power >> 8));
+								ValuePow = Rgb::Power8(Value);
+							}
+
+							void Next()
+							{
+								Power += Step;
+								const uint16_t power = static_cast<uint16_t>(Power >> 8);
+
+								while (Value < UINT8_MAX
+									&& (ValuePow + (static_cast<uint16_t>(Value) << 1) + 1) <= power)
+								{
+									ValuePow += (static_cast<uint16_t>(Value) << 1) + 1;
+									Value++;
+								}
+
+								while (ValuePow > power)
+								{
+									Value--;
+									ValuePow -= (static_cast<uint16_t>(Value) << 1) + 1;
+								}
+							}
+						};
+
+					private:
+						Channel ChannelR;
+						Channel ChannelG;
+						Channel ChannelB;
+
+						// Pixels left before the start of the gradient, held at the start color.
+						uint16_t Hold = 0;
+
+						// Steps left until the end of the gradient, held at the end color afterwards.
+						uint16_t Remaining = 0;
+
+					public:
+						/// <summary>
+						/// Begins a span at position, of a gradient from -> to over length + 1 pixels.
+						/// Positions outside the gradient are held at the end colors.
+						/// </summary>
+						void Start(const rgb_color_t from, const rgb_color_t to, const int32_t position, const uint16_t length)
+						{
+							const uint16_t start = SetRange(position, length);
+							ChannelR.Start(Rgb::Power8(Rgb::R(from)), Rgb::Power8(Rgb::R(to)), start, length);
+							ChannelG.Start(Rgb::Power8(Rgb::G(from)), Rgb::Power8(Rgb::G(to)), start, length);
+							ChannelB.Start(Rgb::Power8(Rgb::B(from)), Rgb::Power8(Rgb::B(to)), start, length);
+						}
+
+						/// <summary>
+						/// Begins a span of a bilinear gradient, at the row fraction between the top and bottom color pairs.
+						/// The blend of squared values is linear along the span, so a single DDA per channel covers it.
+						/// </summary>
+						void Start(const ufraction16_t rowFraction,
+							const rgb_color_t topFrom, const rgb_color_t topTo,
+							const rgb_color_t bottomFrom, const rgb_color_t bottomTo,
+							const int32_t position, const uint16_t length)
+						{
+							const uint16_t start = SetRange(position, length);
+							ChannelR.Start(UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::R(topFrom)), Rgb::Power8(Rgb::R(bottomFrom))),
+								UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::R(topTo)), Rgb::Power8(Rgb::R(bottomTo))),
+								start, length);
+							ChannelG.Start(UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::G(topFrom)), Rgb::Power8(Rgb::G(bottomFrom))),
+								UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::G(topTo)), Rgb::Power8(Rgb::G(bottomTo))),
+								start, length);
+							ChannelB.Start(UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::B(topFrom)), Rgb::Power8(Rgb::B(bottomFrom))),
+								UFraction16::Interpolate(rowFraction, Rgb::Power8(Rgb::B(topTo)), Rgb::Power8(Rgb::B(bottomTo))),
+								start, length);
+						}
+
+						/// <summary>
+						/// Returns the current color and steps one pixel.
+						/// </summary>
+						rgb_color_t Next()
+						{
+							const rgb_color_t color = Rgb::Color(ChannelR.Value, ChannelG.Value, ChannelB.Value);
+
+							if (Hold > 0)
+							{
+								Hold--;
+							}
+							else if (Remaining > 0)
+							{
+								Remaining--;
+								ChannelR.Next();
+								ChannelG.Next();
+								ChannelB.Next();
+							}
+
+							return color;
+						}
+
+					private:
+						/// <summary>
+						/// Sets the hold and remaining steps, returns the clamped start position.
+						/// </summary>
+						uint16_t SetRange(const int32_t position, const uint16_t length)
+						{
+							if (position < 0)
+							{
+								Hold = static_cast<uint16_t>(-position);
+								Remaining = length;
+
+								return 0;
+							}
+							else if (position >= length)
+							{
+								Hold = 0;
+								Remaining = 0;
+
+								return length;
+							}
+							else
+							{
+								Hold = 0;
+								Remaining = static_cast<uint16_t>(length - position);
+
+								return static_cast<uint16_t>(position);
+							}
+						}
+					};
+
 					/// <summary>
 					/// Horizontal gradient color source (left->right) between ColorLeft and ColorRight.
 					/// </summary>
@@ -22,10 +165,16 @@ namespace Egfx
 						dimension_t Width>
 					class GradientX
 					{
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t ColorLeft = RGB_COLOR_WHITE;
 						rgb_color_t ColorRight = RGB_COLOR_BLACK;
 
+					private:
+						GradientSpan Span{};
+
 					public:
 						GradientX() = default;
 						~GradientX() = default;
@@ -40,6 +189,16 @@ namespace Egfx
 							const ufraction16_t fraction = UFraction16::GetScalar<dimension_t>(x, static_cast<dimension_t>(Width - 1));
 							return Rgb::Interpolate(fraction, ColorLeft, ColorRight);
 						}
+
+						void SpanStart(const dimension_t x, const dimension_t /*y*/)
+						{
+							Span.Start(ColorLeft, ColorRight, x, static_cast<uint16_t>((Width > 1) ? (Width - 1) : 0));
+						}
+
+						rgb_color_t SpanNext()
+						{
+							return Span.Next();
+						}
 					};
 
 					/// <summary>
@@ -51,10 +210,17 @@ namespace Egfx
 						dimension_t Height>
 					class GradientY
 					{
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t ColorTop = RGB_COLOR_WHITE;
 						rgb_color_t ColorBottom = RGB_COLOR_BLACK;
 
+					private:
+						// Constant along a span.
+						rgb_color_t SpanColor = RGB_COLOR_BLACK;
+
 					public:
 						GradientY() = default;
 						~GradientY() = default;
@@ -69,6 +235,16 @@ namespace Egfx
 							const ufraction16_t fraction = UFraction16::GetScalar<dimension_t>(y, static_cast<dimension_t>(Height - 1));
 							return Rgb::Interpolate(fraction, ColorTop, ColorBottom);
 						}
+
+						void SpanStart(const dimension_t x, const dimension_t y)
+						{
+							SpanColor = Source(x, y);
+						}
+
+						rgb_color_t SpanNext()
+						{
+							return SpanColor;
+						}
 					};
 
 					/// <summary>
@@ -82,12 +258,18 @@ namespace Egfx
 						dimension_t Height>
 					class GradientXY
 					{
+					public:
+						static constexpr bool IsSpanSource = true;
+
 					public:
 						rgb_color_t ColorTopLeft = RGB_COLOR_BLACK;
 						rgb_color_t ColorTopRight = RGB_COLOR_WHITE;
 						rgb_color_t ColorBottomLeft = RGB_COLOR_WHITE;
 						rgb_color_t ColorBottomRight = RGB_COLOR_BLACK;
 
+					private:
+						GradientSpan Span{};
+
 					public:
 						GradientXY() = default;
 						~GradientXY() = default;
@@ -106,6 +288,21 @@ namespace Egfx
 							const rgb_color_t bot = Rgb::Interpolate(fx, ColorBottomLeft, ColorBottomRight);
 							return Rgb::Interpolate(fy, top, bot);
 						}
+
+						void SpanStart(const dimension_t x, const dimension_t y)
+						{
+							const ufraction16_t fy = (Height <= 1)
+								? static_cast<ufraction16_t>(0)
+								: UFraction16::GetScalar<dimension_t>(y, static_cast<dimension_t>(Height - 1));
+
+							Span.Start(fy, ColorTopLeft, ColorTopRight, ColorBottomLeft, ColorBottomRight,
+								x, static_cast<uint16_t>((Width > 1) ? (Width - 1) : 0));
+						}
+
+						rgb_color_t SpanNext()
+						{
+							return Span.Next();
+						}
 					};
 
 					/// <summary>
@@ -24,6 +24,9 @@ namespace Egfx
 					>
 					class CropRectangle : public Base
 					{
+					private:
+						using Traits = Framework::Shader::Transform::CoordinateTraits<Base>;
+
 					private:
 						dimension_t X = 0;
 						dimension_t Y = 0;
@@ -55,6 +58,63 @@ namespace Egfx
 							return x >= X && x < (X + CropWidth)
 								&& y >= Y && y < (Y + CropHeight);
 						}
+
+						bool SourceBounds(dimension_t& x1, dimension_t& y1, dimension_t& x2, dimension_t& y2) const
+						{
+							if (!Base::SourceBounds(x1, y1, x2, y2))
+							{
+								return false;
+							}
+
+							return CropRange(x1, x2, X, CropWidth, Traits::PreservesX)
+								&& CropRange(y1, y2, Y, CropHeight, Traits::PreservesY);
+						}
+
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							if (!Base::RowBounds(y, x1, x2))
+							{
+								return false;
+							}
+
+							if (Traits::PreservesY
+								&& (y < Y || y >= (Y + CropHeight)))
+							{
+								return false;
+							}
+
+							return CropRange(x1, x2, X, CropWidth, Traits::PreservesX);
+						}
+
+					private:
+						/// <summary>
+						/// Intersects [first, last] with [start, start + size), on an axis preserved by the Base chain.
+						/// </summary>
+						static bool CropRange(dimension_t& first, dimension_t& last,
+							const dimension_t start, const dimension_t size, const bool preserved)
+						{
+							if (!preserved)
+							{
+								return true;
+							}
+
+							const int32_t end = static_cast<int32_t>(start) + size - 1;
+							if (size <= 0 || last < start || first > end)
+							{
+								return false;
+							}
+
+							if (first < start)
+							{
+								first = start;
+							}
+							if (last > end)
+							{
+								last = static_cast<dimension_t>(end);
+							}
+
+							return true;
+						}
 					};
 
 					/// <summary>
@@ -71,11 +131,13 @@ namespace Egfx
 					private:
 						using signed_t = int16_t;
 						using power_t = typename TypeTraits::TypeNext::next_uint_type<dimension_t>::type;
+						using Traits = Framework::Shader::Transform::CoordinateTraits<Base>;
 
 					private:
 						power_t RadiusPow = 0;
 						signed_t OffsetX = 0;
 						signed_t OffsetY = 0;
+						dimension_t Radius = 0;
 
 					public:
 						CropCircle() : Base() {}
@@ -88,6 +150,7 @@ namespace Egfx
 						{
 							OffsetX = offsetX;
 							OffsetY = offsetY;
+							Radius = (radius >= 0) ? radius : 0;
 
 							// Matches SpriteShaderEffect::CropCircleEffect seam tweak for radius > 1.
 							if (radius > 1)
@@ -114,7 +177,97 @@ namespace Egfx
 							return IsInsideCircle(x, y);
 						}
 
+						bool SourceBounds(dimension_t& x1, dimension_t& y1, dimension_t& x2, dimension_t& y2) const
+						{
+							if (!Base::SourceBounds(x1, y1, x2, y2))
+							{
+								return false;
+							}
+
+							return CropRange(x1, x2, OffsetX, Radius, Traits::PreservesX)
+								&& CropRange(y1, y2, OffsetY, Radius, Traits::PreservesY);
+						}
+
+						/// <summary>
+						/// Narrows the row to the circle's chord, when the Base chain preserves both axes.
+						/// </summary>
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							if (!Base::RowBounds(y, x1, x2))
+							{
+								return false;
+							}
+
+							if (!Traits::PreservesY)
+							{
+								return true;
+							}
+
+							const int32_t dy = static_cast<int32_t>(y) - OffsetY;
+							if (AbsValue(dy) > static_cast<int32_t>(Radius))
+							{
+								return false;
+							}
+
+							return CropRange(x1, x2, OffsetX,
+								ChordHalfWidth(static_cast<uint32_t>(RadiusPow) - static_cast<uint32_t>(dy * dy)),
+								Traits::PreservesX);
+						}
+
 					private:
+						/// <summary>
+						/// Intersects [first, last] with [center - halfWidth, center + halfWidth], on an axis preserved by the Base chain.
+						/// </summary>
+						static bool CropRange(dimension_t& first, dimension_t& last,
+							const signed_t center, const dimension_t halfWidth, const bool preserved)
+						{
+							if (!preserved)
+							{
+								return true;
+							}
+
+							const int32_t start = static_cast<int32_t>(center) - halfWidth;
+							const int32_t end = static_cast<int32_t>(center) + halfWidth;
+							if (last < start || first > end)
+							{
+								return false;
+							}
+
+							if (first < start)
+							{
+								first = static_cast<dimension_t>(start);
+							}
+							if (last > end)
+							{
+								last = static_cast<dimension_t>(end);
+							}
+
+							return true;
+						}
+
+						/// <summary>
+						/// Largest half width whose square fits the remaining squared radius, by binary search.
+						/// </summary>
+						dimension_t ChordHalfWidth(const uint32_t remainingPow) const
+						{
+							uint32_t low = 0;
+							uint32_t high = static_cast<uint32_t>(Radius);
+							while (low < high)
+							{
+								const uint32_t middle = (low + high + 1) / 2;
+								if (middle * middle <= remainingPow)
+								{
+									low = middle;
+								}
+								else
+								{
+									high = middle - 1;
+								}
+							}
+
+							return static_cast<dimension_t>(low);
+						}
+
 						bool IsInsideCircle(const dimension_t x, const dimension_t y) const
 						{
 							const power_t xx = AbsValue(static_cast<signed_t>(x) - OffsetX);
@@ -128,6 +281,18 @@ namespace Egfx
 				}
 			}
 		}
+
+		namespace Shader
+		{
+			namespace Transform
+			{
+				template<typename dimension_t, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::CropRectangle<dimension_t, Base>> : CoordinateTraits<Base> {};
+
+				template<typename dimension_t, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::CropCircle<dimension_t, Base>> : CoordinateTraits<Base> {};
+			}
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -28,6 +28,9 @@ namespace Egfx
 					>
 					class DitherMask : public Base
 					{
+					private:
+						using Traits = Framework::Shader::Transform::CoordinateTraits<Base>;
+
 					private:
 						/// <summary>
 						/// Grid modulus (step). Values &lt; 2 disable the mask (all pixels are kept).
@@ -122,6 +125,27 @@ namespace Egfx
 							return (((maskX + OffsetX) % Modulus) == 0)
 								&& (((maskY + OffsetY) % Modulus) == 0);
 						}
+
+						/// <summary>
+						/// Rejects rows off the mask grid, when the Base chain preserves Y.
+						/// </summary>
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							if (!Base::RowBounds(y, x1, x2))
+							{
+								return false;
+							}
+
+							if (!Traits::PreservesY || Modulus < 2)
+							{
+								return true;
+							}
+
+							const pixel_t maskY = static_cast<pixel_t>(
+								UseGlobalCoordinates ? (Origin.y + y) : y);
+
+							return ((maskY + OffsetY) % Modulus) == 0;
+						}
 					};
 
 					/// <summary>
@@ -202,6 +226,18 @@ namespace Egfx
 				}
 			}
 		}
+
+		namespace Shader
+		{
+			namespace Transform
+			{
+				template<typename dimension_t, bool UseGlobalCoordinates, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::DitherMask<dimension_t, UseGlobalCoordinates, Base>> : CoordinateTraits<Base> {};
+
+				template<typename dimension_t, bool UseGlobalCoordinates, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::CheckerboardMask<dimension_t, UseGlobalCoordinates, Base>> : CoordinateTraits<Base> {};
+			}
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -33,6 +33,7 @@ namespace Egfx
 						using Selector = Framework::Shader::Transform::FractionSelector<Width, Height>;
 						using ufraction_t = typename Selector::ufraction_t;
 						using signed_t = typename TypeTraits::TypeNext::next_int_type<dimension_t>::type;
+						using Traits = Framework::Shader::Transform::CoordinateTraits<Base>;
 
 					private:
 						/// <summary>Target width (pixels) produced by the transform.</summary>
@@ -112,6 +113,41 @@ namespace Egfx
 							x = destX;
 							return true;
 						}
+
+						bool SourceBounds(dimension_t& x1, dimension_t& y1, dimension_t& x2, dimension_t& y2) const
+						{
+							return Base::SourceBounds(x1, y1, x2, y2)
+								&& ClampColumns(x1, x2);
+						}
+
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							return Base::RowBounds(y, x1, x2)
+								&& ClampColumns(x1, x2);
+						}
+
+					private:
+						/// <summary>
+						/// Limits the columns to the source width, when the Base chain preserves X.
+						/// Dropped seam columns are still rejected per pixel.
+						/// </summary>
+						static bool ClampColumns(dimension_t& x1, dimension_t& x2)
+						{
+							if (!Traits::PreservesX)
+							{
+								return true;
+							}
+
+							if (x2 < 0 || x1 >= Width)
+							{
+								return false;
+							}
+
+							x1 = MaxValue<dimension_t>(x1, 0);
+							x2 = MinValue<dimension_t>(x2, Width - 1);
+
+							return true;
+						}
 					};
 
 					/// <summary>
@@ -134,6 +170,7 @@ namespace Egfx
 						using Selector = Framework::Shader::Transform::FractionSelector<Width, Height>;
 						using ufraction_t = typename Selector::ufraction_t;
 						using signed_t = typename TypeTraits::TypeNext::next_int_type<dimension_t>::type;
+						using Traits = Framework::Shader::Transform::CoordinateTraits<Base>;
 
 					private:
 						/// <summary>Target height (pixels) produced by the transform.</summary>
@@ -186,6 +223,54 @@ namespace Egfx
 								return false;
 							}
 
+							return MapRow(y);
+						}
+
+						bool SourceBounds(dimension_t& x1, dimension_t& y1, dimension_t& x2, dimension_t& y2) const
+						{
+							if (!Base::SourceBounds(x1, y1, x2, y2))
+							{
+								return false;
+							}
+
+							if (!Traits::PreservesY)
+							{
+								return true;
+							}
+
+							if (y2 < 0 || y1 >= Height)
+							{
+								return false;
+							}
+
+							y1 = MaxValue<dimension_t>(y1, 0);
+							y2 = MinValue<dimension_t>(y2, Height - 1);
+
+							return true;
+						}
+
+						/// <summary>
+						/// Rejects dropped rows, when the Base chain preserves Y.
+						/// </summary>
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							if (!Base::RowBounds(y, x1, x2))
+							{
+								return false;
+							}
+
+							dimension_t row = y;
+
+							return !Traits::PreservesY || MapRow(row);
+						}
+
+					private:
+						/// <summary>
+						/// Packs a source row in-place.
+						/// </summary>
+						/// <returns>False if the row is dropped.</returns>
+						bool MapRow(dimension_t& y) const
+						{
 							if (y < 0 || y >= Height)
 							{
 								return false;
@@ -231,6 +316,26 @@ namespace Egfx
 				}
 			}
 		}
+
+		namespace Shader
+		{
+			namespace Transform
+			{
+				template<typename dimension_t, dimension_t Width, dimension_t Height, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::ScaleDownX<dimension_t, Width, Height, Base>>
+				{
+					static constexpr bool PreservesX = false;
+					static constexpr bool PreservesY = CoordinateTraits<Base>::PreservesY;
+				};
+
+				template<typename dimension_t, dimension_t Width, dimension_t Height, typename Base>
+				struct CoordinateTraits<Assets::Shader::Transform::ScaleDownY<dimension_t, Width, Height, Base>>
+				{
+					static constexpr bool PreservesX = CoordinateTraits<Base>::PreservesX;
+					static constexpr bool PreservesY = false;
+				};
+			}
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -78,6 +78,18 @@ namespace Egfx
 					{
 						return ReadColorAt<dimension_t, Width, uint32_t>(bitmap, x, y);
 					}
+
+					/// <summary>
+					/// Reads the element at a linear index, for encoded bitmap streams.
+					/// </summary>
+					/// <typeparam name="stream_t">Stream element type.</typeparam>
+					/// <param name="stream">Pointer to the stream elements.</param>
+					/// <param name="index">Element index.</param>
+					template<typename stream_t>
+					static stream_t ReadStreamAt(const stream_t* stream, const size_t index)
+					{
+						return stream[index];
+					}
 				};
 
 #if defined(ARDUINO_ARCH_AVR)
@@ -133,6 +145,24 @@ namespace Egfx
 
 						return static_cast<uint32_t>(pgm_read_dword(&bitmap[offset]));
 					}
+
+					/// <summary>
+					/// Reads the element at a linear index from PROGMEM, for encoded bitmap streams.
+					/// </summary>
+					static uint8_t ReadStreamAt(const uint8_t* stream, const size_t index)
+					{
+						return pgm_read_byte(&stream[index]);
+					}
+
+					static uint16_t ReadStreamAt(const uint16_t* stream, const size_t index)
+					{
+						return static_cast<uint16_t>(pgm_read_word(&stream[index]));
+					}
+
+					static uint32_t ReadStreamAt(const uint32_t* stream, const size_t index)
+					{
+						return static_cast<uint32_t>(pgm_read_dword(&stream[index]));
+					}
 				};
 #else
 				/// <summary>
@@ -142,6 +172,107 @@ namespace Egfx
 				using Flash = Ram;
 #endif
 			}
+
+			/// <summary>
+			/// Converts a bitmap pixel value to rgb_color_t.
+			/// 8-bit values are passed through (indexed/paletted or Color332, depending on usage).
+			/// </summary>
+			inline rgb_color_t ToColor(const uint8_t color)
+			{
+				return color;
+			}
+
+			inline rgb_color_t ToColor(const uint16_t color)
+			{
+				return Rgb::Color(color);
+			}
+
+			inline rgb_color_t ToColor(const uint32_t color)
+			{
+				return Rgb::Color(color);
+			}
+
+			/// <summary>
+			/// Copies consecutive 5-6-5 bitmap pixels through IFrameBuffer::RowCopy565().
+			/// RAM pixels are passed in place, other readers go through a small chunk buffer.
+			/// Framebuffer support is fixed, so callers stop offering rows once a copy is refused.
+			/// </summary>
+			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadStreamAt(...).</typeparam>
+			/// <typeparam name="Enabled">Copies nothing when false, for drawers that shade or transform pixels.</typeparam>
+			template<typename BitmapReader, bool Enabled = true>
+			struct RowCopy565
+			{
+			private:
+				// Compile-time dispatch: RAM pixels are passed in place.
+				using RamReaderTag =
+					typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+					IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+					IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+					IntegerSignal::TypeTraits::TypeDispatch::is_same<BitmapReader, Reader::Ram>::value>::type;
+
+				// Pixels per row copy call, for non-RAM readers.
+				static constexpr uint8_t Chunk = 16;
+
+			public:
+				static constexpr bool IsEnabled = Enabled;
+
+				/// <summary>
+				/// Copies count pixels to (x, y).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="pixels">Pointer to the first 5-6-5 pixel.</param>
+				/// <param name="x">Pixel-space X of the first pixel (pixels).</param>
+				/// <param name="y">Pixel-space Y (pixels).</param>
+				/// <param name="count">Number of pixels.</param>
+				/// <param name="useTransparentColor">Skips pixels equal to transparentColor when true.</param>
+				/// <param name="transparentColor">Transparent key color, in 5-6-5.</param>
+				/// <returns>False if the framebuffer has no row copy, nothing was drawn.</returns>
+				static bool Copy(IFrameBuffer* framebuffer, const uint16_t* pixels, const pixel_t x, const pixel_t y, const pixel_t count,
+					const bool useTransparentColor, const uint16_t transparentColor)
+				{
+					return Enabled && Copy(framebuffer, pixels, x, y, count, useTransparentColor, transparentColor, RamReaderTag{});
+				}
+
+				/// <summary>
+				/// Other pixel formats have no row copy.
+				/// </summary>
+				template<typename bitmap_color_t>
+				static bool Copy(IFrameBuffer*, const bitmap_color_t*, const pixel_t, const pixel_t, const pixel_t,
+					const bool, const bitmap_color_t)
+				{
+					return false;
+				}
+
+			private:
+				static bool Copy(IFrameBuffer* framebuffer, const uint16_t* pixels, const pixel_t x, const pixel_t y, const pixel_t count,
+					const bool useTransparentColor, const uint16_t transparentColor, TypeTraits::TypeDispatch::TrueType)
+				{
+					return framebuffer->RowCopy565(pixels, x, y, count, useTransparentColor, transparentColor);
+				}
+
+				static bool Copy(IFrameBuffer* framebuffer, const uint16_t* pixels, const pixel_t x, const pixel_t y, const pixel_t count,
+					const bool useTransparentColor, const uint16_t transparentColor, TypeTraits::TypeDispatch::FalseType)
+				{
+					uint16_t colors[Chunk];
+
+					for (pixel_t chunkStart = 0; chunkStart < count; chunkStart += Chunk)
+					{
+						const uint8_t chunkSize = static_cast<uint8_t>(MinValue<pixel_t>(Chunk, count - chunkStart));
+						for (uint8_t i = 0; i < chunkSize; i++)
+						{
+							colors[i] = BitmapReader::ReadStreamAt(pixels, static_cast<size_t>(chunkStart + i));
+						}
+
+						if (!framebuffer->RowCopy565(colors, static_cast<pixel_t>(x + chunkStart), y, chunkSize,
+							useTransparentColor, transparentColor))
+						{
+							return false;
+						}
+					}
+
+					return true;
+				}
+			};
 		}
 	}
 }
@@ -0,0 +1,417 @@
+#ifndef _EGFX_FRAMEWORK_BITMAP_OPAQUE_RUNS_h
+#define _EGFX_FRAMEWORK_BITMAP_OPAQUE_RUNS_h
+
+#include "TemplateDrawer.h"
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Bitmap
+		{
+			namespace OpaqueRunsGenerator
+			{
+				/// <summary>
+				/// Compile time scan of a constexpr color keyed bitmap.
+				/// Recursion depth is up to Width (Height for the row lookups), keep both within the compiler's constexpr depth.
+				/// </summary>
+				template<typename bitmap_color_t,
+					uint16_t Width,
+					uint16_t Height,
+					const bitmap_color_t* Bitmap,
+					bitmap_color_t KeyColor>
+				struct RowScan
+				{
+					static constexpr bool Opaque(const uint16_t column, const uint16_t row)
+					{
+						return Bitmap[(uint32_t(row) * Width) + column] != KeyColor;
+					}
+
+					static constexpr bool RunStarts(const uint16_t column, const uint16_t row)
+					{
+						return Opaque(column, row) && (column == 0 || !Opaque(column - 1, row));
+					}
+
+					/// <summary>
+					/// Column of the run with the given index, from column onwards. Width if there is none.
+					/// </summary>
+					static constexpr uint16_t RunStart(const uint16_t row, const uint16_t run, const uint16_t column)
+					{
+						return (column >= Width) ? Width
+							: !RunStarts(column, row) ? RunStart(row, run, column + 1)
+							: (run == 0) ? column
+							: RunStart(row, run - 1, column + 1);
+					}
+
+					/// <summary>
+					/// First transparent column from column onwards, Width if there is none.
+					/// </summary>
+					static constexpr uint16_t RunEnd(const uint16_t row, const uint16_t column)
+					{
+						return (column >= Width || !Opaque(column, row)) ? column : RunEnd(row, column + 1);
+					}
+
+					static constexpr uint16_t RowRuns(const uint16_t row, const uint16_t column)
+					{
+						return (column >= Width) ? 0 : (RunStarts(column, row) ? 1 : 0) + RowRuns(row, column + 1);
+					}
+
+					static constexpr uint16_t RowOpaque(const uint16_t row, const uint16_t column)
+					{
+						return (column >= Width) ? 0 : (Opaque(column, row) ? 1 : 0) + RowOpaque(row, column + 1);
+					}
+
+					/// <summary>
+					/// Run length at a run start column, zero for Width.
+					/// </summary>
+					static constexpr uint16_t RunLength(const uint16_t row, const uint16_t start)
+					{
+						return (start >= Width) ? 0 : RunEnd(row, start) - start;
+					}
+
+				};
+
+				template<typename Scan, typename Sequence>
+				struct PackedRows;
+
+				/// <summary>
+				/// Runs of each row, scanned once, to map packed run indexes to rows
+				/// without rescanning the rows before for every element.
+				/// </summary>
+				template<typename Scan, uint16_t... Rows>
+				struct PackedRows<Scan, IndexSequence<Rows...>>
+				{
+					static constexpr uint16_t Height = sizeof...(Rows);
+
+					static constexpr uint16_t Runs[sizeof...(Rows)] = { Scan::RowRuns(Rows, 0)... };
+
+					static constexpr uint16_t Pixels[sizeof...(Rows)] = { Scan::RowOpaque(Rows, 0)... };
+
+					/// <summary>
+					/// Runs in the rows before row, the row's first index in the packed tables.
+					/// </summary>
+					static constexpr uint32_t RowOffset(const uint16_t row)
+					{
+						return (row == 0) ? 0 : RowOffset(row - 1) + Runs[row - 1];
+					}
+
+					/// <summary>
+					/// Opaque pixels in the rows before row.
+					/// </summary>
+					static constexpr uint32_t OpaquePixels(const uint16_t row)
+					{
+						return (row == 0) ? 0 : OpaquePixels(row - 1) + Pixels[row - 1];
+					}
+
+					/// <summary>
+					/// Row of a packed run index, counting from row.
+					/// </summary>
+					static constexpr uint16_t RunRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Runs[row]) ? row : RunRow(index - Runs[row], row + 1);
+					}
+
+					/// <summary>
+					/// Index within its row of a packed run index.
+					/// </summary>
+					static constexpr uint16_t RunInRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Runs[row]) ? index : RunInRow(index - Runs[row], row + 1);
+					}
+
+					/// <summary>
+					/// Start column of a packed run index.
+					/// </summary>
+					static constexpr uint16_t Start(const uint16_t index)
+					{
+						return Scan::RunStart(RunRow(index, 0), RunInRow(index, 0), 0);
+					}
+
+					static constexpr uint16_t Length(const uint16_t index)
+					{
+						return Scan::RunLength(RunRow(index, 0), Start(index));
+					}
+				};
+
+				template<typename Scan, uint16_t... Rows>
+				constexpr uint16_t PackedRows<Scan, IndexSequence<Rows...>>::Runs[sizeof...(Rows)];
+
+				template<typename Scan, uint16_t... Rows>
+				constexpr uint16_t PackedRows<Scan, IndexSequence<Rows...>>::Pixels[sizeof...(Rows)];
+
+				template<typename run_t, typename Packed, typename Sequence>
+				struct RunTable;
+
+				/// <summary>
+				/// Start column and length of every run, packed row after row.
+				/// </summary>
+				template<typename run_t, typename Packed, uint16_t... Indexes>
+				struct RunTable<run_t, Packed, IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr run_t Starts[sizeof...(Indexes)] PROGMEM = { run_t(Packed::Start(Indexes))... };
+					static constexpr run_t Lengths[sizeof...(Indexes)] PROGMEM = { run_t(Packed::Length(Indexes))... };
+#else
+					static constexpr run_t Starts[sizeof...(Indexes)] = { run_t(Packed::Start(Indexes))... };
+					static constexpr run_t Lengths[sizeof...(Indexes)] = { run_t(Packed::Length(Indexes))... };
+#endif
+				};
+
+				template<typename run_t, typename Packed, uint16_t... Indexes>
+				constexpr run_t RunTable<run_t, Packed, IndexSequence<Indexes...>>::Starts[sizeof...(Indexes)];
+
+				template<typename run_t, typename Packed, uint16_t... Indexes>
+				constexpr run_t RunTable<run_t, Packed, IndexSequence<Indexes...>>::Lengths[sizeof...(Indexes)];
+
+				template<typename Packed, typename Sequence>
+				struct OffsetTable;
+
+				/// <summary>
+				/// First packed run of each row, with a closing entry for the run count.
+				/// </summary>
+				template<typename Packed, uint16_t... Indexes>
+				struct OffsetTable<Packed, IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr uint16_t Offsets[sizeof...(Indexes)] PROGMEM = { uint16_t(Packed::RowOffset(Indexes))... };
+#else
+					static constexpr uint16_t Offsets[sizeof...(Indexes)] = { uint16_t(Packed::RowOffset(Indexes))... };
+#endif
+				};
+
+				template<typename Packed, uint16_t... Indexes>
+				constexpr uint16_t OffsetTable<Packed, IndexSequence<Indexes...>>::Offsets[sizeof...(Indexes)];
+			}
+
+			/// <summary>
+			/// Opaque run table of a color keyed bitmap, generated at compile time from the constexpr bitmap.
+			/// Stored next to the pixel data (flash on AVR): the start column and length of every run, packed row after row,
+			/// and each row's first run index.
+			/// Lets TemplateDrawerOpaqueRuns skip transparent spans wholesale, without a key compare per pixel.
+			/// </summary>
+			/// <typeparam name="bitmap_color_t">Bitmap pixel storage type (uint8_t, uint16_t or uint32_t).</typeparam>
+			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+			/// <typeparam name="Bitmap">constexpr row-major bitmap pixels.</typeparam>
+			/// <typeparam name="KeyColor">Transparent key color, in the bitmap's pixel format.</typeparam>
+			template<typename bitmap_color_t,
+				uint16_t Width,
+				uint16_t Height,
+				const bitmap_color_t* Bitmap,
+				bitmap_color_t KeyColor
+			>
+			struct OpaqueRuns
+			{
+			public:
+				using color_t = bitmap_color_t;
+				using run_t = typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<uint8_t, uint16_t, (Width <= UINT8_MAX)>::type;
+
+				static constexpr uint16_t BitmapWidth = Width;
+				static constexpr uint16_t BitmapHeight = Height;
+				static constexpr bitmap_color_t Key = KeyColor;
+
+			private:
+				using Packed = OpaqueRunsGenerator::PackedRows<OpaqueRunsGenerator::RowScan<bitmap_color_t, Width, Height, Bitmap, KeyColor>,
+					typename MakeIndexSequence<Height>::type>;
+
+				static_assert(Height < UINT16_MAX, "OpaqueRuns height is limited to 65534 rows.");
+				static_assert(Packed::RowOffset(Height) > 0, "OpaqueRuns bitmap has no opaque pixels.");
+				static_assert(Packed::RowOffset(Height) <= UINT16_MAX, "OpaqueRuns table is limited to 65535 runs.");
+
+				using Table = OpaqueRunsGenerator::RunTable<run_t, Packed,
+					typename MakeIndexSequence<uint16_t(Packed::RowOffset(Height))>::type>;
+
+				using Offsets = OpaqueRunsGenerator::OffsetTable<Packed,
+					typename MakeIndexSequence<uint16_t(Height + 1)>::type>;
+
+			public:
+				/// <summary>
+				/// Number of runs in all rows.
+				/// </summary>
+				static constexpr uint16_t RunCount = uint16_t(Packed::RowOffset(Height));
+
+				/// <summary>
+				/// Runs average at least 8 pixels. A row copy call per run then beats the framebuffer's keyed row copy,
+				/// shorter runs are cheaper to key compare than to copy one by one.
+				/// </summary>
+				static constexpr bool LongRuns = Packed::OpaquePixels(Height) >= (uint32_t(RunCount) * 8);
+
+				static const bitmap_color_t* GetBitmap()
+				{
+					return Bitmap;
+				}
+
+				/// <summary>
+				/// Packed index of a row's first run. The row's runs end at the next row's first run.
+				/// </summary>
+				static uint16_t RowOffset(const uint16_t row)
+				{
+					return Read(&Offsets::Offsets[row]);
+				}
+
+				/// <summary>
+				/// Start column of a packed run.
+				/// </summary>
+				static run_t Start(const uint16_t index)
+				{
+					return Read(&Table::Starts[index]);
+				}
+
+				/// <summary>
+				/// Length of a packed run.
+				/// </summary>
+				static run_t Length(const uint16_t index)
+				{
+					return Read(&Table::Lengths[index]);
+				}
+
+			private:
+				static uint8_t Read(const uint8_t* value)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return pgm_read_byte(value);
+#else
+					return *value;
+#endif
+				}
+
+				static uint16_t Read(const uint16_t* value)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return static_cast<uint16_t>(pgm_read_word(value));
+#else
+					return *value;
+#endif
+				}
+			};
+
+			/// <summary>
+			/// Bitmap drawer for color keyed bitmaps with an OpaqueRuns table (no scaling, no transform).
+			///
+			/// Reads only the opaque runs of each row, clamped to the clip rectangle.
+			/// Unshaded 5-6-5 pixels go through IFrameBuffer::RowCopy565() when the framebuffer supports it:
+			/// one copy per run for OpaqueRuns::LongRuns, otherwise one keyed copy from the row's first to last opaque pixel.
+			/// </summary>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="OpaqueRunsType">OpaqueRuns table of the bitmap.</typeparam>
+			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadColorAt(...) and ReadStreamAt(...).</typeparam>
+			/// <typeparam name="ColorShaderType">Color shader type providing Shade(color).</typeparam>
+			template<typename dimension_t,
+				typename OpaqueRunsType,
+				typename BitmapReader = Reader::Flash,
+				typename ColorShaderType = Shader::Color::NoShader<dimension_t>
+			>
+			class TemplateDrawerOpaqueRuns : public Shader::Pixel::ClipRectangle
+			{
+			private:
+				using bitmap_color_t = typename OpaqueRunsType::color_t;
+
+				static constexpr dimension_t Width = static_cast<dimension_t>(OpaqueRunsType::BitmapWidth);
+				static constexpr dimension_t Height = static_cast<dimension_t>(OpaqueRunsType::BitmapHeight);
+
+				// Unshaded 5-6-5 rows are offered to the framebuffer's row copy.
+				using RowCopier = RowCopy565<BitmapReader,
+					IntegerSignal::TypeTraits::TypeDispatch::is_same<ColorShaderType, Shader::Color::NoShader<dimension_t>>::value>;
+
+				using index_t = typename TypeTraits::TypeNext::next_uint_type<dimension_t>::type;
+
+			public:
+				/// <summary>Color shader applied to each opaque bitmap pixel.</summary>
+				ColorShaderType ColorShader{};
+
+			public:
+				TemplateDrawerOpaqueRuns() {}
+				~TemplateDrawerOpaqueRuns() = default;
+
+				/// <summary>
+				/// Draws the opaque runs of the table's bitmap.
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y)
+				{
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					const bitmap_color_t* bitmap = OpaqueRunsType::GetBitmap();
+
+					bool rowCopy = true;
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						const uint16_t runsStart = OpaqueRunsType::RowOffset(static_cast<uint16_t>(row));
+						const uint16_t runsEnd = OpaqueRunsType::RowOffset(static_cast<uint16_t>(row + 1));
+						if (runsStart == runsEnd)
+						{
+							continue;
+						}
+
+						const pixel_t runY = static_cast<pixel_t>(y + static_cast<pixel_t>(row));
+
+						if (rowCopy && !OpaqueRunsType::LongRuns)
+						{
+							const dimension_t rowFirst = MaxValue(static_cast<dimension_t>(OpaqueRunsType::Start(runsStart)), firstColumn);
+							const dimension_t rowLast = MinValue(static_cast<dimension_t>(OpaqueRunsType::Start(runsEnd - 1) + OpaqueRunsType::Length(runsEnd - 1) - 1), lastColumn);
+							if (rowFirst > rowLast)
+							{
+								continue;
+							}
+
+							const index_t offset = (static_cast<index_t>(row) * static_cast<index_t>(Width)) + static_cast<index_t>(rowFirst);
+
+							rowCopy = RowCopier::Copy(framebuffer, &bitmap[offset], static_cast<pixel_t>(x + static_cast<pixel_t>(rowFirst)), runY,
+								static_cast<pixel_t>(rowLast - rowFirst + 1), true, OpaqueRunsType::Key);
+							if (rowCopy)
+							{
+								continue;
+							}
+						}
+
+						for (uint16_t run = runsStart; run < runsEnd; run++)
+						{
+							const dimension_t start = static_cast<dimension_t>(OpaqueRunsType::Start(run));
+							if (start > lastColumn)
+							{
+								break;
+							}
+
+							const dimension_t length = static_cast<dimension_t>(OpaqueRunsType::Length(run));
+							const dimension_t runFirst = MaxValue(start, firstColumn);
+							const dimension_t runLast = MinValue(static_cast<dimension_t>(start + length - 1), lastColumn);
+							if (runFirst > runLast)
+							{
+								continue;
+							}
+
+							if (rowCopy)
+							{
+								const index_t offset = (static_cast<index_t>(row) * static_cast<index_t>(Width)) + static_cast<index_t>(runFirst);
+
+								rowCopy = RowCopier::Copy(framebuffer, &bitmap[offset], static_cast<pixel_t>(x + static_cast<pixel_t>(runFirst)), runY,
+									static_cast<pixel_t>(runLast - runFirst + 1), false, bitmap_color_t(0));
+								if (rowCopy)
+								{
+									continue;
+								}
+							}
+
+							for (dimension_t column = runFirst; column <= runLast; column++)
+							{
+								framebuffer->Pixel(ColorShader.Shade(ToColor(BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row))),
+									static_cast<pixel_t>(x + static_cast<pixel_t>(column)), runY);
+							}
+						}
+					}
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,489 @@
+#ifndef _EGFX_FRAMEWORK_BITMAP_RLE_DRAWER_h
+#define _EGFX_FRAMEWORK_BITMAP_RLE_DRAWER_h
+
+#include "TemplateDrawer.h"
+#include "../../Model/IndexSequence.h"
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Bitmap
+		{
+			/// <summary>
+			/// PackBits style run-length encoded bitmap.
+			///
+			/// Stored as two streams: packet header bytes, and the colors in the bitmap's pixel type (uint8_t, uint16_t or uint32_t).
+			/// Each header describes one packet:
+			///  - Bit 7 set: repeat packet, the next color is used for (header & 0x7F) + 1 pixels.
+			///  - Bit 7 clear: literal packet, the next header + 1 colors are used once each.
+			/// Packets never cross rows, so each row starts with a new packet.
+			/// </summary>
+			namespace Rle
+			{
+				static constexpr uint8_t RepeatFlag = 0x80;
+				static constexpr uint8_t CountMask = 0x7F;
+
+				/// <summary>
+				/// Most pixels in a single packet.
+				/// </summary>
+				static constexpr uint8_t MaxCount = CountMask + 1;
+
+				/// <summary>
+				/// Pixel count of a packet.
+				/// </summary>
+				static constexpr uint8_t PacketCount(const uint8_t header)
+				{
+					return static_cast<uint8_t>((header & CountMask) + 1);
+				}
+			}
+
+			namespace RleGenerator
+			{
+				/// <summary>
+				/// Compile time PackBits encode of a constexpr bitmap.
+				/// Two or more equal pixels become a repeat packet, everything else goes in literal packets.
+				/// Recursion depth is up to Width + 2 (Height for the row lookups), keep it within the compiler's constexpr depth.
+				/// </summary>
+				template<typename bitmap_color_t,
+					uint16_t Width,
+					uint16_t Height,
+					const bitmap_color_t* Bitmap>
+				struct RowScan
+				{
+					using color_t = bitmap_color_t;
+
+					static constexpr bitmap_color_t Pixel(const uint16_t column, const uint16_t row)
+					{
+						return Bitmap[(uint32_t(row) * Width) + column];
+					}
+
+					static constexpr bool Repeats(const uint16_t column, const uint16_t row)
+					{
+						return (column + 1 < Width) && (Pixel(column, row) == Pixel(column + 1, row));
+					}
+
+					static constexpr uint16_t RepeatEnd(const uint16_t row, const uint16_t start, const uint16_t column)
+					{
+						return (column >= Width || (column - start) >= Rle::MaxCount || Pixel(column, row) != Pixel(start, row))
+							? column : RepeatEnd(row, start, column + 1);
+					}
+
+					static constexpr uint16_t LiteralEnd(const uint16_t row, const uint16_t start, const uint16_t column)
+					{
+						return (column >= Width || (column - start) >= Rle::MaxCount || Repeats(column, row))
+							? column : LiteralEnd(row, start, column + 1);
+					}
+
+					/// <summary>
+					/// Column after the packet that starts at column.
+					/// </summary>
+					static constexpr uint16_t PacketEnd(const uint16_t row, const uint16_t column)
+					{
+						return Repeats(column, row) ? RepeatEnd(row, column, column + 1) : LiteralEnd(row, column, column + 1);
+					}
+
+					static constexpr uint8_t Header(const uint16_t row, const uint16_t column)
+					{
+						return uint8_t((Repeats(column, row) ? Rle::RepeatFlag : 0) | (PacketEnd(row, column) - column - 1));
+					}
+
+					static constexpr uint16_t PacketColors(const uint16_t row, const uint16_t column)
+					{
+						return Repeats(column, row) ? 1 : (PacketEnd(row, column) - column);
+					}
+
+					static constexpr uint16_t RowPackets(const uint16_t row, const uint16_t column)
+					{
+						return (column >= Width) ? 0 : 1 + RowPackets(row, PacketEnd(row, column));
+					}
+
+					static constexpr uint16_t RowColors(const uint16_t row, const uint16_t column)
+					{
+						return (column >= Width) ? 0 : PacketColors(row, column) + RowColors(row, PacketEnd(row, column));
+					}
+
+					/// <summary>
+					/// Start column of a row's packet, counting from the packet at column.
+					/// </summary>
+					static constexpr uint16_t PacketColumn(const uint16_t row, const uint16_t packet, const uint16_t column)
+					{
+						return (packet == 0) ? column : PacketColumn(row, packet - 1, PacketEnd(row, column));
+					}
+
+					/// <summary>
+					/// Color of a row's color index, counting from the packet at column.
+					/// </summary>
+					static constexpr bitmap_color_t RowColor(const uint16_t row, const uint16_t index, const uint16_t column)
+					{
+						return (index < PacketColors(row, column))
+							? Pixel(Repeats(column, row) ? column : uint16_t(column + index), row)
+							: RowColor(row, index - PacketColors(row, column), PacketEnd(row, column));
+					}
+				};
+
+				template<typename Scan, typename Sequence>
+				struct PackedRows;
+
+				/// <summary>
+				/// Packets and colors of each row, scanned once, to map packed stream indexes to rows
+				/// without rescanning the rows before for every element.
+				/// </summary>
+				template<typename Scan, uint16_t... Rows>
+				struct PackedRows<Scan, IndexSequence<Rows...>>
+				{
+					static constexpr uint16_t Height = sizeof...(Rows);
+
+					static constexpr uint16_t Packets[sizeof...(Rows)] = { Scan::RowPackets(Rows, 0)... };
+					static constexpr uint16_t Colors[sizeof...(Rows)] = { Scan::RowColors(Rows, 0)... };
+
+					static constexpr uint32_t HeaderCount(const uint16_t row)
+					{
+						return (row >= Height) ? 0 : Packets[row] + HeaderCount(row + 1);
+					}
+
+					static constexpr uint32_t ColorCount(const uint16_t row)
+					{
+						return (row >= Height) ? 0 : Colors[row] + ColorCount(row + 1);
+					}
+
+					static constexpr uint16_t HeaderRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Packets[row]) ? row : HeaderRow(index - Packets[row], row + 1);
+					}
+
+					/// <summary>
+					/// Index within its row of a packed header index.
+					/// </summary>
+					static constexpr uint16_t HeaderInRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Packets[row]) ? index : HeaderInRow(index - Packets[row], row + 1);
+					}
+
+					static constexpr uint16_t ColorRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Colors[row]) ? row : ColorRow(index - Colors[row], row + 1);
+					}
+
+					static constexpr uint16_t ColorInRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Colors[row]) ? index : ColorInRow(index - Colors[row], row + 1);
+					}
+
+					static constexpr uint8_t Header(const uint16_t index)
+					{
+						return Scan::Header(HeaderRow(index, 0), Scan::PacketColumn(HeaderRow(index, 0), HeaderInRow(index, 0), 0));
+					}
+
+					static constexpr typename Scan::color_t Color(const uint16_t index)
+					{
+						return Scan::RowColor(ColorRow(index, 0), ColorInRow(index, 0), 0);
+					}
+				};
+
+				template<typename Scan, uint16_t... Rows>
+				constexpr uint16_t PackedRows<Scan, IndexSequence<Rows...>>::Packets[sizeof...(Rows)];
+
+				template<typename Scan, uint16_t... Rows>
+				constexpr uint16_t PackedRows<Scan, IndexSequence<Rows...>>::Colors[sizeof...(Rows)];
+
+				template<typename Packed, typename Sequence>
+				struct HeaderTable;
+
+				template<typename Packed, uint16_t... Indexes>
+				struct HeaderTable<Packed, IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr uint8_t Headers[sizeof...(Indexes)] PROGMEM = { Packed::Header(Indexes)... };
+#else
+					static constexpr uint8_t Headers[sizeof...(Indexes)] = { Packed::Header(Indexes)... };
+#endif
+				};
+
+				template<typename Packed, uint16_t... Indexes>
+				constexpr uint8_t HeaderTable<Packed, IndexSequence<Indexes...>>::Headers[sizeof...(Indexes)];
+
+				template<typename bitmap_color_t, typename Packed, typename Sequence>
+				struct ColorTable;
+
+				template<typename bitmap_color_t, typename Packed, uint16_t... Indexes>
+				struct ColorTable<bitmap_color_t, Packed, IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr bitmap_color_t Colors[sizeof...(Indexes)] PROGMEM = { Packed::Color(Indexes)... };
+#else
+					static constexpr bitmap_color_t Colors[sizeof...(Indexes)] = { Packed::Color(Indexes)... };
+#endif
+				};
+
+				template<typename bitmap_color_t, typename Packed, uint16_t... Indexes>
+				constexpr bitmap_color_t ColorTable<bitmap_color_t, Packed, IndexSequence<Indexes...>>::Colors[sizeof...(Indexes)];
+			}
+
+			/// <summary>
+			/// Rle bitmap model for streams encoded offline.
+			/// </summary>
+			/// <typeparam name="bitmap_color_t">Bitmap pixel storage type (uint8_t, uint16_t or uint32_t).</typeparam>
+			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+			/// <typeparam name="Headers">Packet header bytes.</typeparam>
+			/// <typeparam name="Colors">Packet colors.</typeparam>
+			template<typename bitmap_color_t,
+				uint16_t Width,
+				uint16_t Height,
+				const uint8_t* Headers,
+				const bitmap_color_t* Colors
+			>
+			struct RleBitmap
+			{
+				using color_t = bitmap_color_t;
+
+				static constexpr uint16_t BitmapWidth = Width;
+				static constexpr uint16_t BitmapHeight = Height;
+
+				static const uint8_t* GetHeaders()
+				{
+					return Headers;
+				}
+
+				static const bitmap_color_t* GetColors()
+				{
+					return Colors;
+				}
+			};
+
+			/// <summary>
+			/// Rle bitmap model, encoded at compile time from a constexpr bitmap.
+			/// The streams are stored next to the pixel data (flash on AVR), the raw bitmap is only needed at compile time.
+			/// Compile time grows with packets times width, large bitmaps are better encoded offline into an RleBitmap.
+			/// </summary>
+			/// <typeparam name="bitmap_color_t">Bitmap pixel storage type (uint8_t, uint16_t or uint32_t).</typeparam>
+			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+			/// <typeparam name="Bitmap">constexpr row-major bitmap pixels.</typeparam>
+			template<typename bitmap_color_t,
+				uint16_t Width,
+				uint16_t Height,
+				const bitmap_color_t* Bitmap
+			>
+			struct RleEncodedBitmap
+			{
+			private:
+				using Packed = RleGenerator::PackedRows<RleGenerator::RowScan<bitmap_color_t, Width, Height, Bitmap>,
+					typename MakeIndexSequence<Height>::type>;
+
+				static_assert(Width > 0 && Height > 0, "RleEncodedBitmap size is out of range.");
+				static_assert(Packed::HeaderCount(0) <= UINT16_MAX, "RleEncodedBitmap is limited to 65535 packets.");
+				static_assert(Packed::ColorCount(0) <= UINT16_MAX, "RleEncodedBitmap is limited to 65535 colors.");
+
+			public:
+				using color_t = bitmap_color_t;
+
+				static constexpr uint16_t BitmapWidth = Width;
+				static constexpr uint16_t BitmapHeight = Height;
+
+				/// <summary>Encoded stream sizes, in elements.</summary>
+				static constexpr uint16_t HeaderCount = uint16_t(Packed::HeaderCount(0));
+				static constexpr uint16_t ColorCount = uint16_t(Packed::ColorCount(0));
+
+			private:
+				using Headers = RleGenerator::HeaderTable<Packed, typename MakeIndexSequence<HeaderCount>::type>;
+				using Colors = RleGenerator::ColorTable<bitmap_color_t, Packed, typename MakeIndexSequence<ColorCount>::type>;
+
+			public:
+				static const uint8_t* GetHeaders()
+				{
+					return Headers::Headers;
+				}
+
+				static const bitmap_color_t* GetColors()
+				{
+					return Colors::Colors;
+				}
+			};
+
+			/// <summary>
+			/// Bitmap drawer for Rle encoded bitmaps (no scaling, no transform).
+			///
+			/// Decodes straight from the streams, without a temporary image.
+			/// Repeat packets become a single horizontal line, literal packets are drawn per pixel,
+			/// or copied through IFrameBuffer::RowCopy565() for unshaded 5-6-5 colors.
+			/// Rows above the clip rectangle are still parsed, their packets are skipped without drawing.
+			/// </summary>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadStreamAt(...).</typeparam>
+			/// <typeparam name="TransparentColor">Transparent key color (RGB888).</typeparam>
+			/// <typeparam name="UseTransparentColor">Enables transparent key color skipping when true.</typeparam>
+			/// <typeparam name="ColorShaderType">Color shader type providing Shade(color).</typeparam>
+			template<typename dimension_t,
+				dimension_t Width,
+				dimension_t Height,
+				typename BitmapReader = Reader::Flash,
+				rgb_color_t TransparentColor = RGB_COLOR_BLACK,
+				bool UseTransparentColor = false,
+				typename ColorShaderType = Shader::Color::NoShader<dimension_t>
+			>
+			class TemplateDrawerRle : public Shader::Pixel::ClipRectangle
+			{
+			private:
+				using intermediate_t = typename TypeTraits::TypeNext::next_uint_type<dimension_t>::type;
+
+				// Unshaded 5-6-5 literal packets are offered to the framebuffer's row copy.
+				using RowCopier = RowCopy565<BitmapReader,
+					IntegerSignal::TypeTraits::TypeDispatch::is_same<ColorShaderType, Shader::Color::NoShader<dimension_t>>::value>;
+
+			public:
+				/// <summary>Color shader applied to each decoded bitmap pixel.</summary>
+				ColorShaderType ColorShader{};
+
+			public:
+				TemplateDrawerRle() {}
+				~TemplateDrawerRle() = default;
+
+				/// <summary>
+				/// Draws an 8-bit Rle bitmap (indexed/paletted or Color332, depending on usage).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="headers">Pointer to the packet header bytes.</param>
+				/// <param name="colors">Pointer to the packet colors.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* headers, const uint8_t* colors)
+				{
+					static constexpr uint8_t TransparentColor8 =
+						Rgb::Color332From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawStream(framebuffer, x, y, headers, colors, TransparentColor8);
+				}
+
+				/// <summary>
+				/// Draws a 16-bit Rle bitmap (RGB565).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="headers">Pointer to the packet header bytes.</param>
+				/// <param name="colors">Pointer to the packet colors.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* headers, const uint16_t* colors)
+				{
+					static constexpr uint16_t TransparentColor16 =
+						Rgb::Color565From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawStream(framebuffer, x, y, headers, colors, TransparentColor16);
+				}
+
+				/// <summary>
+				/// Draws a 32-bit Rle bitmap (RGB888 or ARGB8888, depending on usage).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="headers">Pointer to the packet header bytes.</param>
+				/// <param name="colors">Pointer to the packet colors.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* headers, const uint32_t* colors)
+				{
+					static constexpr uint32_t TransparentColor32 =
+						Rgb::Color888From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawStream(framebuffer, x, y, headers, colors, TransparentColor32);
+				}
+
+			private:
+				template<typename bitmap_color_t>
+				void DrawStream(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y,
+					const uint8_t* headers, const bitmap_color_t* colors, const bitmap_color_t transparentColor)
+				{
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					bool rowCopy = true;
+
+					size_t headerIndex = 0;
+					size_t colorIndex = 0;
+					for (dimension_t row = 0; row <= lastRow; row++)
+					{
+						const bool visible = row >= firstRow;
+						const pixel_t rowY = static_cast<pixel_t>(y + static_cast<pixel_t>(row));
+
+						intermediate_t column = 0;
+						while (column < Width)
+						{
+							const uint8_t header = BitmapReader::ReadStreamAt(headers, headerIndex++);
+							const uint8_t count = Rle::PacketCount(header);
+
+							// Packet columns within the clip.
+							const intermediate_t packetFirst = MaxValue<intermediate_t>(column, firstColumn);
+							const intermediate_t packetLast = MinValue<intermediate_t>(column + count - 1, lastColumn);
+							const bool drawn = visible && packetFirst <= packetLast;
+
+							if ((header & Rle::RepeatFlag) != 0)
+							{
+								if (drawn)
+								{
+									const bitmap_color_t color = BitmapReader::ReadStreamAt(colors, colorIndex);
+									if (!(UseTransparentColor && (color == transparentColor)))
+									{
+										Span(framebuffer, ColorShader.Shade(ToColor(color)),
+											static_cast<pixel_t>(x + static_cast<pixel_t>(packetFirst)),
+											static_cast<pixel_t>(x + static_cast<pixel_t>(packetLast)), rowY);
+									}
+								}
+								colorIndex++;
+							}
+							else
+							{
+								if (drawn)
+								{
+									const size_t first = colorIndex + static_cast<size_t>(packetFirst - column);
+									const pixel_t literalX = static_cast<pixel_t>(x + static_cast<pixel_t>(packetFirst));
+									const pixel_t literalCount = static_cast<pixel_t>(packetLast - packetFirst + 1);
+
+									if (rowCopy)
+									{
+										rowCopy = RowCopier::Copy(framebuffer, &colors[first], literalX, rowY, literalCount, UseTransparentColor, transparentColor);
+									}
+
+									if (!rowCopy)
+									{
+										for (pixel_t i = 0; i < literalCount; i++)
+										{
+											const bitmap_color_t color = BitmapReader::ReadStreamAt(colors, first + static_cast<size_t>(i));
+											if (!(UseTransparentColor && (color == transparentColor)))
+											{
+												framebuffer->Pixel(ColorShader.Shade(ToColor(color)), static_cast<pixel_t>(literalX + i), rowY);
+											}
+										}
+									}
+								}
+								colorIndex += count;
+							}
+
+							column += count;
+						}
+					}
+				}
+
+				static void Span(IFrameBuffer* framebuffer, const rgb_color_t color, const pixel_t x1, const pixel_t x2, const pixel_t y)
+				{
+					if (x1 == x2)
+					{
+						framebuffer->Pixel(color, x1, y);
+					}
+					else
+					{
+						framebuffer->LineHorizontal(color, x1, x2, y);
+					}
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define _EGFX_FRAMEWORK_BITMAP_TEMPLATE_DRAWABLE_h
 
 #include "TemplateDrawer.h"
+#include "RleDrawer.h"
+#include "../Layout/Model.h"
 
 namespace Egfx
 {
@@ -11,7 +13,7 @@ namespace Egfx
 		{
 			/// <summary>
 			/// Layout-bound drawable for a 3-3-2 (8-bit) bitmap source.
-			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y().
+			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y(), clipped to the layout.
 			/// </summary>
 			/// <typeparam name="ParentLayout">Parent layout providing X/Y/Width/Height.</typeparam>
 			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
@@ -64,6 +66,7 @@ namespace Egfx
 					: Base()
 					, BitmapSource(bitmap)
 				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
 				}
 
 				~Bitmap332Drawable() = default;
@@ -77,7 +80,7 @@ namespace Egfx
 
 			/// <summary>
 			/// Layout-bound drawable for a 5-6-5 (16-bit) bitmap source.
-			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y().
+			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y(), clipped to the layout.
 			/// </summary>
 			/// <inheritdoc />
 			template<
@@ -120,6 +123,7 @@ namespace Egfx
 					: Base()
 					, BitmapSource(bitmap)
 				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
 				}
 
 				~Bitmap565Drawable() = default;
@@ -133,7 +137,7 @@ namespace Egfx
 
 			/// <summary>
 			/// Layout-bound drawable for a 8-8-8 (32-bit) bitmap source.
-			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y().
+			/// Wraps a bitmap pointer and draws it using Bitmap::TemplateDrawer at ParentLayout::X()/Y(), clipped to the layout.
 			/// </summary>
 			/// <inheritdoc />
 			template<
@@ -176,6 +180,7 @@ namespace Egfx
 					: Base()
 					, BitmapSource(bitmap)
 				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
 				}
 
 				~Bitmap888Drawable() = default;
@@ -186,6 +191,56 @@ namespace Egfx
 					Base::Draw(framebuffer, ParentLayout::X(), ParentLayout::Y(), BitmapSource);
 				}
 			};
+
+			/// <summary>
+			/// Layout-bound drawable for an Rle bitmap model (RleBitmap or RleEncodedBitmap).
+			/// Draws it using Bitmap::TemplateDrawerRle at ParentLayout::X()/Y(), clipped to the layout.
+			/// </summary>
+			/// <typeparam name="ParentLayout">Parent layout providing X/Y/Width/Height.</typeparam>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="RleBitmapType">Rle bitmap model providing color_t, BitmapWidth/BitmapHeight, GetHeaders() and GetColors().</typeparam>
+			/// <typeparam name="BitmapReader">Bitmap reader (e.g., flash/RAM) used by TemplateDrawerRle.</typeparam>
+			/// <typeparam name="TransparentColor">Transparent key color (source-space RGB), if enabled.</typeparam>
+			/// <typeparam name="UseTransparentColor">Enables transparent keying when true.</typeparam>
+			/// <typeparam name="ColorShaderType">Optional color shader applied per pixel.</typeparam>
+			template<
+				typename ParentLayout,
+				typename dimension_t,
+				typename RleBitmapType,
+				typename BitmapReader = Reader::Flash,
+				rgb_color_t TransparentColor = RGB_COLOR_BLACK,
+				bool UseTransparentColor = false,
+				typename ColorShaderType = Shader::Color::NoShader<dimension_t>
+			>
+			class RleBitmapDrawable : public TemplateDrawerRle<
+				dimension_t,
+				static_cast<dimension_t>(RleBitmapType::BitmapWidth), static_cast<dimension_t>(RleBitmapType::BitmapHeight),
+				BitmapReader,
+				TransparentColor, UseTransparentColor,
+				ColorShaderType>
+			{
+			private:
+				using Base = TemplateDrawerRle<
+					dimension_t,
+					static_cast<dimension_t>(RleBitmapType::BitmapWidth), static_cast<dimension_t>(RleBitmapType::BitmapHeight),
+					BitmapReader,
+					TransparentColor, UseTransparentColor,
+					ColorShaderType>;
+
+			public:
+				RleBitmapDrawable() : Base()
+				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
+				}
+
+				~RleBitmapDrawable() = default;
+
+				/// <summary>Draws the bitmap at ParentLayout::X(), ParentLayout::Y().</summary>
+				void Draw(IFrameBuffer* framebuffer)
+				{
+					Base::Draw(framebuffer, ParentLayout::X(), ParentLayout::Y(), RleBitmapType::GetHeaders(), RleBitmapType::GetColors());
+				}
+			};
 		}
 	}
 }
@@ -4,6 +4,7 @@
 #include "Model.h"
 #include "../Shader/Color/Shaders.h"
 #include "../Shader/Transform/Shaders.h"
+#include "../Shader/Pixel/Clip.h"
 
 namespace Egfx
 {
@@ -20,7 +21,7 @@ namespace Egfx
 			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
 			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
 			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
-			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadColorAt(...).</typeparam>
+			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadColorAt(...) and ReadStreamAt(...).</typeparam>
 			/// <typeparam name="TransparentColor">Transparent key color (RGB888).</typeparam>
 			/// <typeparam name="UseTransparentColor">Enables transparent key color skipping when true.</typeparam>
 			/// <typeparam name="ColorShaderType">Color shader type providing Shade(color).</typeparam>
@@ -34,8 +35,24 @@ namespace Egfx
 				typename ColorShaderType = Shader::Color::NoShader<dimension_t>,
 				typename TransformShaderType = Shader::Transform::NoTransform<dimension_t>
 			>
-			class TemplateDrawerNoScale
+			class TemplateDrawerNoScale : public Shader::Pixel::ClipRectangle
 			{
+			private:
+				// Compile-time dispatch: bitmaps are clamped to the clip rectangle up front, unless the transform moves coordinates.
+				using ClipBoundsTag =
+					typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+					IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+					IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+					Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesX
+					&& Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesY>::type;
+
+				// Unshaded, untransformed 5-6-5 rows are offered to the framebuffer's row copy.
+				using RowCopier = RowCopy565<BitmapReader,
+					IntegerSignal::TypeTraits::TypeDispatch::is_same<ColorShaderType, Shader::Color::NoShader<dimension_t>>::value
+					&& IntegerSignal::TypeTraits::TypeDispatch::is_same<TransformShaderType, Shader::Transform::NoTransform<dimension_t>>::value>;
+
+				using index_t = typename TypeTraits::TypeNext::next_uint_type<dimension_t>::type;
+
 			public:
 				/// <summary>Color shader applied to each sampled bitmap pixel.</summary>
 				ColorShaderType ColorShader{};
@@ -61,9 +78,26 @@ namespace Egfx
 
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow, ClipBoundsTag{})
+						|| !TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint8_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -74,7 +108,9 @@ namespace Egfx
 
 							dimension_t tx = column;
 							dimension_t ty = row;
-							if (TransformShader.Transform(tx, ty))
+							if (TransformShader.Transform(tx, ty)
+								&& ClipContains(static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
+									static_cast<pixel_t>(y + static_cast<pixel_t>(ty)), ClipBoundsTag{}))
 							{
 								framebuffer->Pixel(ColorShader.Shade(bitmapColor),
 									static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
@@ -96,11 +132,33 @@ namespace Egfx
 					static constexpr uint16_t TransparentColor16 =
 						Rgb::Color565From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
 
+					if (RowCopy(framebuffer, x, y, bitmap, TransparentColor16))
+					{
+						return;
+					}
+
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow, ClipBoundsTag{})
+						|| !TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint16_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -111,7 +169,9 @@ namespace Egfx
 
 							dimension_t tx = column;
 							dimension_t ty = row;
-							if (TransformShader.Transform(tx, ty))
+							if (TransformShader.Transform(tx, ty)
+								&& ClipContains(static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
+									static_cast<pixel_t>(y + static_cast<pixel_t>(ty)), ClipBoundsTag{}))
 							{
 								framebuffer->Pixel(ColorShader.Shade(Rgb::Color(bitmapColor)),
 									static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
@@ -135,9 +195,26 @@ namespace Egfx
 
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow, ClipBoundsTag{})
+						|| !TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint32_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -148,7 +225,9 @@ namespace Egfx
 
 							dimension_t tx = column;
 							dimension_t ty = row;
-							if (TransformShader.Transform(tx, ty))
+							if (TransformShader.Transform(tx, ty)
+								&& ClipContains(static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
+									static_cast<pixel_t>(y + static_cast<pixel_t>(ty)), ClipBoundsTag{}))
 							{
 								framebuffer->Pixel(ColorShader.Shade(Rgb::Color(bitmapColor)),
 									static_cast<pixel_t>(x + static_cast<pixel_t>(tx)),
@@ -157,6 +236,43 @@ namespace Egfx
 						}
 					}
 				}
+
+			private:
+				/// <summary>
+				/// Copies whole clipped rows through IFrameBuffer::RowCopy565().
+				/// </summary>
+				/// <returns>False if the framebuffer has no row copy, nothing was drawn.</returns>
+				bool RowCopy(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint16_t* bitmap, const uint16_t transparentColor)
+				{
+					if (!RowCopier::IsEnabled)
+					{
+						return false;
+					}
+
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = Width - 1;
+					dimension_t lastRow = Height - 1;
+					if (!ClipLocal(x, y, firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return true;
+					}
+
+					const pixel_t count = static_cast<pixel_t>(lastColumn - firstColumn + 1);
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						const index_t offset = (static_cast<index_t>(row) * static_cast<index_t>(Width)) + static_cast<index_t>(firstColumn);
+
+						if (!RowCopier::Copy(framebuffer, &bitmap[offset], static_cast<pixel_t>(x + static_cast<pixel_t>(firstColumn)),
+							static_cast<pixel_t>(y + static_cast<pixel_t>(row)), count, UseTransparentColor, transparentColor))
+						{
+							return false;
+						}
+					}
+
+					return true;
+				}
 			};
 
 			/// <summary>
@@ -186,8 +302,17 @@ namespace Egfx
 				typename ColorShaderType = Shader::Color::NoShader<dimension_t>,
 				typename TransformShaderType = Shader::Transform::NoTransform<dimension_t>
 			>
-			struct TemplateDrawerIntegerScale
+			struct TemplateDrawerIntegerScale : public Shader::Pixel::ClipRectangle
 			{
+			private:
+				// Compile-time dispatch: bitmaps are clamped to the clip rectangle up front, unless the transform moves coordinates.
+				using ClipBoundsTag =
+					typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+					IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+					IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+					Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesX
+					&& Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesY>::type;
+
 			public:
 				/// <summary>Color shader applied to each sampled bitmap pixel.</summary>
 				ColorShaderType ColorShader{};
@@ -213,9 +338,36 @@ namespace Egfx
 
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					// Loop limits in source pixels, from the clip rectangle in scaled local space.
+					int32_t firstX = 0;
+					int32_t firstY = 0;
+					int32_t lastX = (static_cast<int32_t>(Width) * ScaleX) - 1;
+					int32_t lastY = (static_cast<int32_t>(Height) * ScaleY) - 1;
+					if (!ClipLocal(x, y, firstX, firstY, lastX, lastY, ClipBoundsTag{}))
+					{
+						return;
+					}
+
+					// The transform works on source pixels, before scaling.
+					dimension_t firstColumn = static_cast<dimension_t>(firstX / ScaleX);
+					dimension_t firstRow = static_cast<dimension_t>(firstY / ScaleY);
+					dimension_t lastColumn = static_cast<dimension_t>(lastX / ScaleX);
+					dimension_t lastRow = static_cast<dimension_t>(lastY / ScaleY);
+					if (!TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint8_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -231,14 +383,20 @@ namespace Egfx
 								continue;
 							}
 
-							const pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
-							const pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
+							pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t endX = static_cast<pixel_t>(startX + (ScaleX - 1));
+							pixel_t endY = static_cast<pixel_t>(startY + (ScaleY - 1));
 
-							framebuffer->RectangleFill(ColorShader.Shade(bitmapColor),
-								startX,
-								startY,
-								static_cast<pixel_t>(startX + (ScaleX - 1)),
-								static_cast<pixel_t>(startY + (ScaleY - 1)));
+							// Edge cells may be partially clipped.
+							if (ClipArea(startX, startY, endX, endY))
+							{
+								framebuffer->RectangleFill(ColorShader.Shade(bitmapColor),
+									startX,
+									startY,
+									endX,
+									endY);
+							}
 						}
 					}
 				}
@@ -257,9 +415,36 @@ namespace Egfx
 
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					// Loop limits in source pixels, from the clip rectangle in scaled local space.
+					int32_t firstX = 0;
+					int32_t firstY = 0;
+					int32_t lastX = (static_cast<int32_t>(Width) * ScaleX) - 1;
+					int32_t lastY = (static_cast<int32_t>(Height) * ScaleY) - 1;
+					if (!ClipLocal(x, y, firstX, firstY, lastX, lastY, ClipBoundsTag{}))
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						return;
+					}
+
+					// The transform works on source pixels, before scaling.
+					dimension_t firstColumn = static_cast<dimension_t>(firstX / ScaleX);
+					dimension_t firstRow = static_cast<dimension_t>(firstY / ScaleY);
+					dimension_t lastColumn = static_cast<dimension_t>(lastX / ScaleX);
+					dimension_t lastRow = static_cast<dimension_t>(lastY / ScaleY);
+					if (!TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint16_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -275,14 +460,20 @@ namespace Egfx
 								continue;
 							}
 
-							const pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
-							const pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
+							pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t endX = static_cast<pixel_t>(startX + (ScaleX - 1));
+							pixel_t endY = static_cast<pixel_t>(startY + (ScaleY - 1));
 
-							framebuffer->RectangleFill(ColorShader.Shade(Rgb::Color(bitmapColor)),
-								startX,
-								startY,
-								static_cast<pixel_t>(startX + (ScaleX - 1)),
-								static_cast<pixel_t>(startY + (ScaleY - 1)));
+							// Edge cells may be partially clipped.
+							if (ClipArea(startX, startY, endX, endY))
+							{
+								framebuffer->RectangleFill(ColorShader.Shade(Rgb::Color(bitmapColor)),
+									startX,
+									startY,
+									endX,
+									endY);
+							}
 						}
 					}
 				}
@@ -301,9 +492,36 @@ namespace Egfx
 
 					TransformShader.Prepare(x, y);
 
-					for (dimension_t row = 0; row < Height; row++)
+					// Loop limits in source pixels, from the clip rectangle in scaled local space.
+					int32_t firstX = 0;
+					int32_t firstY = 0;
+					int32_t lastX = (static_cast<int32_t>(Width) * ScaleX) - 1;
+					int32_t lastY = (static_cast<int32_t>(Height) * ScaleY) - 1;
+					if (!ClipLocal(x, y, firstX, firstY, lastX, lastY, ClipBoundsTag{}))
 					{
-						for (dimension_t column = 0; column < Width; column++)
+						return;
+					}
+
+					// The transform works on source pixels, before scaling.
+					dimension_t firstColumn = static_cast<dimension_t>(firstX / ScaleX);
+					dimension_t firstRow = static_cast<dimension_t>(firstY / ScaleY);
+					dimension_t lastColumn = static_cast<dimension_t>(lastX / ScaleX);
+					dimension_t lastRow = static_cast<dimension_t>(lastY / ScaleY);
+					if (!TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!TransformShader.RowBounds(row, rowFirst, rowLast))
+						{
+							continue;
+						}
+
+						for (dimension_t column = rowFirst; column <= rowLast; column++)
 						{
 							const uint32_t bitmapColor = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
 
@@ -319,16 +537,311 @@ namespace Egfx
 								continue;
 							}
 
-							const pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
-							const pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t startX = static_cast<pixel_t>(x + (static_cast<pixel_t>(tx) * static_cast<pixel_t>(ScaleX)));
+							pixel_t startY = static_cast<pixel_t>(y + (static_cast<pixel_t>(ty) * static_cast<pixel_t>(ScaleY)));
+							pixel_t endX = static_cast<pixel_t>(startX + (ScaleX - 1));
+							pixel_t endY = static_cast<pixel_t>(startY + (ScaleY - 1));
+
+							// Edge cells may be partially clipped.
+							if (ClipArea(startX, startY, endX, endY))
+							{
+								framebuffer->RectangleFill(ColorShader.Shade(Rgb::Color(bitmapColor)),
+									startX,
+									startY,
+									endX,
+									endY);
+							}
+						}
+					}
+				}
+			};
+
+			/// <summary>
+			/// Bitmap drawer (fractional scaling).
+			///
+			/// Scales the bitmap to any destination size, set at runtime with SetSize().
+			/// Destination rows and columns step through the source with a 16.16 fixed-point DDA.
+			/// Destination pixels that sample the same source pixel are merged and emitted as one line or rectangle fill.
+			/// BoxFilter averages a 2x2 source block on downscaled axes, for RGB565 and RGB888 bitmaps only.
+			/// No transform shader, for transforms use TemplateDrawerNoScale or TemplateDrawerIntegerScale.
+			/// </summary>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="Width">Bitmap width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmap height (pixels).</typeparam>
+			/// <typeparam name="BitmapReader">Bitmap reader type providing ReadColorAt(...).</typeparam>
+			/// <typeparam name="TransparentColor">Transparent key color (RGB888).</typeparam>
+			/// <typeparam name="UseTransparentColor">Enables transparent key color skipping when true.</typeparam>
+			/// <typeparam name="ColorShaderType">Color shader type providing Shade(color).</typeparam>
+			/// <typeparam name="BoxFilter">Enables the 2x2 box filter on downscaled axes.</typeparam>
+			template<typename dimension_t,
+				dimension_t Width,
+				dimension_t Height,
+				typename BitmapReader = Reader::Flash,
+				rgb_color_t TransparentColor = RGB_COLOR_BLACK,
+				bool UseTransparentColor = false,
+				typename ColorShaderType = Shader::Color::NoShader<dimension_t>,
+				bool BoxFilter = false
+			>
+			class TemplateDrawerFractionalScale : public Shader::Pixel::ClipRectangle
+			{
+			private:
+				static_assert(Width > 0 && Height > 0, "TemplateDrawerFractionalScale requires a non-empty bitmap.");
+				static_assert(Width <= 4096 && Height <= 4096, "TemplateDrawerFractionalScale bitmap dimensions must fit 16.16 fixed-point stepping.");
+
+				static constexpr uint8_t FixedShift = 16;
+				static constexpr uint32_t FixedOne = uint32_t(1) << FixedShift;
+
+				// Compile-time dispatch: box filtered sampling.
+				using BoxFilterTag =
+					typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+					IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+					IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+					BoxFilter>::type;
+
+			public:
+				/// <summary>Color shader applied to each sampled bitmap pixel.</summary>
+				ColorShaderType ColorShader{};
+
+			private:
+				pixel_t TargetWidth = Width;
+				pixel_t TargetHeight = Height;
+
+				// Source pixels per destination pixel (16.16).
+				uint32_t StepX = FixedOne;
+				uint32_t StepY = FixedOne;
+
+			public:
+				TemplateDrawerFractionalScale() {}
+				~TemplateDrawerFractionalScale() = default;
+
+				/// <summary>
+				/// Sets the destination size (pixels). Non-positive sizes draw nothing.
+				/// </summary>
+				void SetSize(const pixel_t width, const pixel_t height)
+				{
+					TargetWidth = width;
+					TargetHeight = height;
+					StepX = (width > 0) ? ((static_cast<uint32_t>(Width) << FixedShift) / static_cast<uint32_t>(width)) : 0;
+					StepY = (height > 0) ? ((static_cast<uint32_t>(Height) << FixedShift) / static_cast<uint32_t>(height)) : 0;
+				}
+
+				pixel_t GetWidth() const
+				{
+					return TargetWidth;
+				}
+
+				pixel_t GetHeight() const
+				{
+					return TargetHeight;
+				}
+
+				/// <summary>
+				/// Draws an 8-bit bitmap (indexed/paletted or Color332, depending on usage). Always nearest sampled.
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* bitmap)
+				{
+					static constexpr uint8_t TransparentColor8 =
+						Rgb::Color332From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawScaled(framebuffer, x, y, bitmap, TransparentColor8, TypeTraits::TypeDispatch::FalseType{});
+				}
+
+				/// <summary>
+				/// Draws a 16-bit bitmap (RGB565).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint16_t* bitmap)
+				{
+					static constexpr uint16_t TransparentColor16 =
+						Rgb::Color565From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawScaled(framebuffer, x, y, bitmap, TransparentColor16, BoxFilterTag{});
+				}
+
+				/// <summary>
+				/// Draws a 32-bit bitmap (RGB888 or ARGB8888, depending on usage).
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="bitmap">Pointer to row-major bitmap pixels.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint32_t* bitmap)
+				{
+					static constexpr uint32_t TransparentColor32 =
+						Rgb::Color888From888(Rgb::R8(TransparentColor), Rgb::G8(TransparentColor), Rgb::B8(TransparentColor));
+
+					DrawScaled(framebuffer, x, y, bitmap, TransparentColor32, BoxFilterTag{});
+				}
+
+			private:
+				template<typename bitmap_color_t, typename FilterTag>
+				void DrawScaled(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y,
+					const bitmap_color_t* bitmap, const bitmap_color_t transparentColor, FilterTag filterTag)
+				{
+					if (TargetWidth <= 0 || TargetHeight <= 0)
+					{
+						return;
+					}
+
+					// Destination area, limited to the clip rectangle.
+					const pixel_rectangle_t clip = GetClip();
+					const int32_t x1 = MaxValue<int32_t>(x, clip.topLeft.x);
+					const int32_t y1 = MaxValue<int32_t>(y, clip.topLeft.y);
+					const int32_t x2 = MinValue<int32_t>(static_cast<int32_t>(x) + TargetWidth - 1, clip.bottomRight.x);
+					const int32_t y2 = MinValue<int32_t>(static_cast<int32_t>(y) + TargetHeight - 1, clip.bottomRight.y);
+					if (x1 > x2 || y1 > y2)
+					{
+						return;
+					}
+
+					// Sample at the destination pixel centers.
+					const uint32_t columnStart = (StepX / 2) + (static_cast<uint32_t>(x1 - x) * StepX);
+					uint32_t v = (StepY / 2) + (static_cast<uint32_t>(y1 - y) * StepY);
+
+					// Box filter taps, only on downscaled axes.
+					const bool tapX = StepX > FixedOne;
+					const bool tapY = StepY > FixedOne;
+
+					int32_t row = y1;
+					while (row <= y2)
+					{
+						// Destination rows that sample the same source row are drawn as one band.
+						const dimension_t sourceRow = static_cast<dimension_t>(v >> FixedShift);
+						int32_t rowEnd = row;
+						v += StepY;
+						while (rowEnd < y2 && static_cast<dimension_t>(v >> FixedShift) == sourceRow)
+						{
+							rowEnd++;
+							v += StepY;
+						}
+
+						uint32_t u = columnStart;
+						int32_t column = x1;
+						while (column <= x2)
+						{
+							// Destination columns that sample the same source column share the color.
+							const dimension_t sourceColumn = static_cast<dimension_t>(u >> FixedShift);
+							int32_t columnEnd = column;
+							u += StepX;
+							while (columnEnd < x2 && static_cast<dimension_t>(u >> FixedShift) == sourceColumn)
+							{
+								columnEnd++;
+								u += StepX;
+							}
+
+							bitmap_color_t color;
+							if (Sample(bitmap, sourceColumn, sourceRow, tapX, tapY, transparentColor, color, filterTag))
+							{
+								Fill(framebuffer, ColorShader.Shade(ToColor(color)), column, row, columnEnd, rowEnd);
+							}
 
-							framebuffer->RectangleFill(ColorShader.Shade(Rgb::Color(bitmapColor)),
-								startX,
-								startY,
-								static_cast<pixel_t>(startX + (ScaleX - 1)),
-								static_cast<pixel_t>(startY + (ScaleY - 1)));
+							column = columnEnd + 1;
 						}
+
+						row = rowEnd + 1;
+					}
+				}
+
+				static void Fill(IFrameBuffer* framebuffer, const rgb_color_t color,
+					const int32_t x1, const int32_t y1, const int32_t x2, const int32_t y2)
+				{
+					if (y1 != y2)
+					{
+						framebuffer->RectangleFill(color,
+							static_cast<pixel_t>(x1), static_cast<pixel_t>(y1),
+							static_cast<pixel_t>(x2), static_cast<pixel_t>(y2));
+					}
+					else if (x1 != x2)
+					{
+						framebuffer->LineHorizontal(color,
+							static_cast<pixel_t>(x1), static_cast<pixel_t>(x2), static_cast<pixel_t>(y1));
+					}
+					else
+					{
+						framebuffer->Pixel(color, static_cast<pixel_t>(x1), static_cast<pixel_t>(y1));
+					}
+				}
+
+				/// <summary>
+				/// Nearest sample. False if transparent.
+				/// </summary>
+				template<typename bitmap_color_t>
+				static bool Sample(const bitmap_color_t* bitmap, const dimension_t column, const dimension_t row,
+					const bool, const bool,
+					const bitmap_color_t transparentColor, bitmap_color_t& color, TypeTraits::TypeDispatch::FalseType)
+				{
+					color = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
+
+					return !UseTransparentColor || (color != transparentColor);
+				}
+
+				/// <summary>
+				/// 2x2 box filtered sample. False if the nearest source pixel is transparent.
+				/// Transparent taps take the nearest color, so the key color never bleeds into the edges.
+				/// </summary>
+				template<typename bitmap_color_t>
+				static bool Sample(const bitmap_color_t* bitmap, const dimension_t column, const dimension_t row,
+					const bool tapX, const bool tapY,
+					const bitmap_color_t transparentColor, bitmap_color_t& color, TypeTraits::TypeDispatch::TrueType)
+				{
+					const bitmap_color_t nearest = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
+					if (UseTransparentColor && (nearest == transparentColor))
+					{
+						return false;
+					}
+
+					const dimension_t nextColumn = (tapX && (column + 1) < Width) ? static_cast<dimension_t>(column + 1) : column;
+					const dimension_t nextRow = (tapY && (row + 1) < Height) ? static_cast<dimension_t>(row + 1) : row;
+
+					color = Average(nearest,
+						ReadTap(bitmap, nextColumn, row, nearest, transparentColor),
+						ReadTap(bitmap, column, nextRow, nearest, transparentColor),
+						ReadTap(bitmap, nextColumn, nextRow, nearest, transparentColor));
+
+					return true;
+				}
+
+				template<typename bitmap_color_t>
+				static bitmap_color_t ReadTap(const bitmap_color_t* bitmap, const dimension_t column, const dimension_t row,
+					const bitmap_color_t nearest, const bitmap_color_t transparentColor)
+				{
+					const bitmap_color_t tap = BitmapReader::template ReadColorAt<dimension_t, Width>(bitmap, column, row);
+
+					return (UseTransparentColor && (tap == transparentColor)) ? nearest : tap;
+				}
+
+				/// <summary>
+				/// Per channel average of 4 RGB565 colors.
+				/// </summary>
+				static uint16_t Average(const uint16_t a, const uint16_t b, const uint16_t c, const uint16_t d)
+				{
+					const uint16_t red = static_cast<uint16_t>(((a >> 11) + (b >> 11) + (c >> 11) + (d >> 11) + 2) >> 2);
+					const uint16_t green = static_cast<uint16_t>((((a >> 5) & 0x3F) + ((b >> 5) & 0x3F) + ((c >> 5) & 0x3F) + ((d >> 5) & 0x3F) + 2) >> 2);
+					const uint16_t blue = static_cast<uint16_t>(((a & 0x1F) + (b & 0x1F) + (c & 0x1F) + (d & 0x1F) + 2) >> 2);
+
+					return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+				}
+
+				/// <summary>
+				/// Per channel average of 4 RGB888 colors, the top byte is kept from the first.
+				/// </summary>
+				static uint32_t Average(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d)
+				{
+					uint32_t color = a & 0xFF000000;
+					for (uint8_t shift = 0; shift < 24; shift += 8)
+					{
+						const uint32_t sum = ((a >> shift) & 0xFF) + ((b >> shift) & 0xFF) + ((c >> shift) & 0xFF) + ((d >> shift) & 0xFF);
+						color |= ((sum + 2) >> 2) << shift;
 					}
+
+					return color;
 				}
 			};
 
@@ -43,6 +43,16 @@ namespace Egfx
 
 						return mask[offset];
 					}
+
+					/// <summary>
+					/// Reads the byte at a linear index, for encoded bitmask streams.
+					/// </summary>
+					/// <param name="stream">Pointer to the stream bytes.</param>
+					/// <param name="index">Byte index.</param>
+					static uint8_t ReadStreamAt(const uint8_t* stream, const size_t index)
+					{
+						return stream[index];
+					}
 				};
 
 				/// <summary>
@@ -72,6 +82,20 @@ namespace Egfx
 #else
 						// On non-AVR, treat as RAM.
 						return mask[offset];
+#endif
+					}
+
+					/// <summary>
+					/// Reads the byte at a linear index, for encoded bitmask streams.
+					/// </summary>
+					/// <param name="stream">Pointer to the stream bytes.</param>
+					/// <param name="index">Byte index.</param>
+					static uint8_t ReadStreamAt(const uint8_t* stream, const size_t index)
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return pgm_read_byte(&stream[index]);
+#else
+						return stream[index];
 #endif
 					}
 				};
@@ -0,0 +1,262 @@
+#ifndef _EGFX_FRAMEWORK_BITMASK_RLE_DRAWER_h
+#define _EGFX_FRAMEWORK_BITMASK_RLE_DRAWER_h
+
+#include "Model.h"
+#include "../Shader/Primitive/Shaders.h"
+#include "../../Model/IndexSequence.h"
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Bitmask
+		{
+			namespace RleGenerator
+			{
+				/// <summary>
+				/// Compile time run-length encode of a constexpr packed 1bpp mask (MSB first, rows padded to whole bytes).
+				/// Each row alternates clear and set run lengths, starting with clear. Runs over 255 are split with a zero length run.
+				/// Recursion depth is up to Width + 2 (Height for the row lookups), keep it within the compiler's constexpr depth.
+				/// </summary>
+				template<uint16_t Width,
+					uint16_t Height,
+					const uint8_t* Mask>
+				struct RowScan
+				{
+					static constexpr uint16_t BytesPerLine = (Width + BitsPerByte - 1) / BitsPerByte;
+
+					static constexpr bool Set(const uint16_t column, const uint16_t row)
+					{
+						return ((Mask[(uint32_t(row) * BytesPerLine) + (column / BitsPerByte)] >> (BitsPerByte - 1 - (column % BitsPerByte))) & 1) != 0;
+					}
+
+					static constexpr uint16_t RunEnd(const uint16_t row, const uint16_t start, const uint16_t column, const bool set)
+					{
+						return (column >= Width || (column - start) >= UINT8_MAX || Set(column, row) != set)
+							? column : RunEnd(row, start, column + 1, set);
+					}
+
+					static constexpr uint8_t RunLength(const uint16_t row, const uint16_t column, const bool set)
+					{
+						return uint8_t(RunEnd(row, column, column, set) - column);
+					}
+
+					static constexpr uint16_t RowRuns(const uint16_t row, const uint16_t column, const bool set)
+					{
+						return (column >= Width) ? 0 : 1 + RowRuns(row, column + RunLength(row, column, set), !set);
+					}
+
+					/// <summary>
+					/// Length of a row's run, counting from the run at column.
+					/// </summary>
+					static constexpr uint8_t RowRun(const uint16_t row, const uint16_t run, const uint16_t column, const bool set)
+					{
+						return (run == 0) ? RunLength(row, column, set) : RowRun(row, run - 1, column + RunLength(row, column, set), !set);
+					}
+				};
+
+				template<typename Scan, typename Sequence>
+				struct PackedRows;
+
+				/// <summary>
+				/// Runs of each row, scanned once, to map packed stream indexes to rows
+				/// without rescanning the rows before for every element.
+				/// </summary>
+				template<typename Scan, uint16_t... Rows>
+				struct PackedRows<Scan, IndexSequence<Rows...>>
+				{
+					static constexpr uint16_t Height = sizeof...(Rows);
+
+					static constexpr uint16_t Runs[sizeof...(Rows)] = { Scan::RowRuns(Rows, 0, false)... };
+
+					static constexpr uint32_t RunCount(const uint16_t row)
+					{
+						return (row >= Height) ? 0 : Runs[row] + RunCount(row + 1);
+					}
+
+					static constexpr uint16_t RunRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Runs[row]) ? row : RunRow(index - Runs[row], row + 1);
+					}
+
+					/// <summary>
+					/// Index within its row of a packed run index.
+					/// </summary>
+					static constexpr uint16_t RunInRow(const uint16_t index, const uint16_t row)
+					{
+						return (row >= Height || index < Runs[row]) ? index : RunInRow(index - Runs[row], row + 1);
+					}
+
+					static constexpr uint8_t Run(const uint16_t index)
+					{
+						return Scan::RowRun(RunRow(index, 0), RunInRow(index, 0), 0, false);
+					}
+				};
+
+				template<typename Scan, uint16_t... Rows>
+				constexpr uint16_t PackedRows<Scan, IndexSequence<Rows...>>::Runs[sizeof...(Rows)];
+
+				template<typename Packed, typename Sequence>
+				struct RunTable;
+
+				template<typename Packed, uint16_t... Indexes>
+				struct RunTable<Packed, IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr uint8_t Runs[sizeof...(Indexes)] PROGMEM = { Packed::Run(Indexes)... };
+#else
+					static constexpr uint8_t Runs[sizeof...(Indexes)] = { Packed::Run(Indexes)... };
+#endif
+				};
+
+				template<typename Packed, uint16_t... Indexes>
+				constexpr uint8_t RunTable<Packed, IndexSequence<Indexes...>>::Runs[sizeof...(Indexes)];
+			}
+
+			/// <summary>
+			/// Rle bitmask model for run streams encoded offline.
+			/// </summary>
+			/// <typeparam name="Width">Bitmask width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmask height (pixels).</typeparam>
+			/// <typeparam name="Runs">Run length bytes.</typeparam>
+			template<uint16_t Width,
+				uint16_t Height,
+				const uint8_t* Runs
+			>
+			struct RleBitmask
+			{
+				static constexpr uint16_t MaskWidth = Width;
+				static constexpr uint16_t MaskHeight = Height;
+
+				static const uint8_t* GetRuns()
+				{
+					return Runs;
+				}
+			};
+
+			/// <summary>
+			/// Rle bitmask model, encoded at compile time from a constexpr packed mask.
+			/// The runs are stored next to the mask data (flash on AVR), the packed mask is only needed at compile time.
+			/// Compile time grows with runs times width, large masks are better encoded offline into an RleBitmask.
+			/// </summary>
+			/// <typeparam name="Width">Bitmask width (pixels).</typeparam>
+			/// <typeparam name="Height">Bitmask height (pixels).</typeparam>
+			/// <typeparam name="Mask">constexpr packed 1bpp mask bytes.</typeparam>
+			template<uint16_t Width,
+				uint16_t Height,
+				const uint8_t* Mask
+			>
+			struct RleEncodedBitmask
+			{
+			private:
+				using Packed = RleGenerator::PackedRows<RleGenerator::RowScan<Width, Height, Mask>,
+					typename MakeIndexSequence<Height>::type>;
+
+				static_assert(Width > 0 && Height > 0, "RleEncodedBitmask size is out of range.");
+				static_assert(Packed::RunCount(0) <= UINT16_MAX, "RleEncodedBitmask is limited to 65535 runs.");
+
+			public:
+				static constexpr uint16_t MaskWidth = Width;
+				static constexpr uint16_t MaskHeight = Height;
+
+				/// <summary>Encoded stream size, in bytes.</summary>
+				static constexpr uint16_t RunCount = uint16_t(Packed::RunCount(0));
+
+			private:
+				using Table = RleGenerator::RunTable<Packed, typename MakeIndexSequence<RunCount>::type>;
+
+			public:
+				static const uint8_t* GetRuns()
+				{
+					return Table::Runs;
+				}
+			};
+
+			/// <summary>
+			/// Bitmask drawer for run-length encoded 1bpp masks.
+			///
+			/// The stream holds, for each row, byte run lengths that alternate between clear and set pixels,
+			/// starting with clear (which may be 0). A row ends once its runs add up to MaskWidth, runs never cross rows.
+			/// Runs longer than 255 are split with a zero length run of the other kind in between.
+			///
+			/// Each set run is drawn as one horizontal line through the primitive shader, without a temporary image.
+			/// Rows above the clip rectangle, or rejected by the transform's row bounds, are still parsed, their runs are skipped without drawing.
+			/// </summary>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="MaskWidth">Bitmask width (pixels).</typeparam>
+			/// <typeparam name="MaskHeight">Bitmask height (pixels).</typeparam>
+			/// <typeparam name="MaskReader">Mask reader type providing ReadStreamAt(...).</typeparam>
+			/// <typeparam name="PrimitiveShaderType">Primitive shader type providing Prepare(...) and primitive draw calls.</typeparam>
+			template<typename dimension_t,
+				dimension_t MaskWidth,
+				dimension_t MaskHeight,
+				typename MaskReader = Reader::Flash,
+				typename PrimitiveShaderType = Shader::Primitive::TemplateShader<dimension_t>
+			>
+			struct TemplateDrawerRle : PrimitiveShaderType
+			{
+			private:
+				using intermediate_t = typename TypeTraits::TypeNext::next_uint_type<dimension_t>::type;
+
+			public:
+				TemplateDrawerRle() : PrimitiveShaderType() {}
+				~TemplateDrawerRle() = default;
+
+				/// <summary>
+				/// Draws the mask at the given pixel-space origin.
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				/// <param name="x">Pixel-space origin X (pixels).</param>
+				/// <param name="y">Pixel-space origin Y (pixels).</param>
+				/// <param name="stream">Pointer to the encoded mask runs.</param>
+				void Draw(IFrameBuffer* framebuffer, const pixel_t x, const pixel_t y, const uint8_t* stream)
+				{
+					PrimitiveShaderType::Prepare(x, y);
+
+					// Trivial reject and row/column limits from the clip rectangle and the transform's source bounds.
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = MaskWidth - 1;
+					dimension_t lastRow = MaskHeight - 1;
+					if (!PrimitiveShaderType::ClipBounds(firstColumn, firstRow, lastColumn, lastRow)
+						|| !PrimitiveShaderType::TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
+					{
+						return;
+					}
+
+					size_t index = 0;
+					for (dimension_t row = 0; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						const bool visible = row >= firstRow
+							&& PrimitiveShaderType::TransformShader.RowBounds(row, rowFirst, rowLast);
+
+						intermediate_t column = 0;
+						bool set = false;
+						while (column < MaskWidth)
+						{
+							const uint8_t length = MaskReader::ReadStreamAt(stream, index++);
+
+							if (set && visible && length > 0)
+							{
+								const intermediate_t runFirst = MaxValue<intermediate_t>(column, rowFirst);
+								const intermediate_t runLast = MinValue<intermediate_t>(column + length - 1, rowLast);
+								if (runFirst <= runLast)
+								{
+									PrimitiveShaderType::Line(framebuffer,
+										static_cast<dimension_t>(runFirst), row,
+										static_cast<dimension_t>(runLast), row);
+								}
+							}
+
+							column += length;
+							set = !set;
+						}
+					}
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define _EGFX_FRAMEWORK_BITMASK_TEMPLATE_DRAWABLE_h
 
 #include "TemplateDrawer.h"
+#include "RleDrawer.h"
+#include "../Layout/Model.h"
 
 namespace Egfx
 {
@@ -13,7 +15,7 @@ namespace Egfx
 			/// Drawable wrapper for a packed 1bpp bitmask.
 			///
 			/// Binds a bitmask source pointer to a layout and renders it using the selected bitmask drawer
-			/// (unscaled or integer scaled) backed by a primitive shader.
+			/// (unscaled or integer scaled) backed by a primitive shader, clipped to the layout.
 			/// </summary>
 			/// <typeparam name="ParentLayout">Parent layout providing X/Y/Width/Height.</typeparam>
 			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
@@ -67,6 +69,7 @@ namespace Egfx
 					: Base()
 					, Source(bitmask)
 				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
 				}
 
 				~BitmaskDrawable() = default;
@@ -80,6 +83,55 @@ namespace Egfx
 					Base::Draw(framebuffer, ParentLayout::X(), ParentLayout::Y(), Source);
 				}
 			};
+
+			/// <summary>
+			/// Drawable wrapper for an Rle bitmask model (RleBitmask or RleEncodedBitmask).
+			///
+			/// Renders the model's runs at the layout origin using TemplateDrawerRle, clipped to the layout.
+			/// </summary>
+			/// <typeparam name="ParentLayout">Parent layout providing X/Y/Width/Height.</typeparam>
+			/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+			/// <typeparam name="RleBitmaskType">Rle bitmask model providing MaskWidth/MaskHeight and GetRuns().</typeparam>
+			/// <typeparam name="MaskReader">Mask reader type providing ReadStreamAt(...).</typeparam>
+			/// <typeparam name="PrimitiveShaderType">Primitive shader type providing Prepare(...) and primitive draw calls.</typeparam>
+			template<
+				typename ParentLayout,
+				typename dimension_t,
+				typename RleBitmaskType,
+				typename MaskReader = Framework::Bitmask::Reader::Flash,
+				typename PrimitiveShaderType = Shader::Primitive::TemplateShader<dimension_t>
+			>
+			class RleBitmaskDrawable : public TemplateDrawerRle<
+				dimension_t,
+				static_cast<dimension_t>(RleBitmaskType::MaskWidth), static_cast<dimension_t>(RleBitmaskType::MaskHeight),
+				MaskReader,
+				PrimitiveShaderType
+			>
+			{
+			private:
+				using Base = TemplateDrawerRle<
+					dimension_t,
+					static_cast<dimension_t>(RleBitmaskType::MaskWidth), static_cast<dimension_t>(RleBitmaskType::MaskHeight),
+					MaskReader,
+					PrimitiveShaderType>;
+
+			public:
+				RleBitmaskDrawable() : Base()
+				{
+					Base::SetClip(LayoutRectangle<ParentLayout>());
+				}
+
+				~RleBitmaskDrawable() = default;
+
+				/// <summary>
+				/// Draws the bitmask at the layout origin.
+				/// </summary>
+				/// <param name="framebuffer">Target framebuffer to draw into.</param>
+				void Draw(IFrameBuffer* framebuffer)
+				{
+					Base::Draw(framebuffer, ParentLayout::X(), ParentLayout::Y(), RleBitmaskType::GetRuns());
+				}
+			};
 		}
 	}
 }
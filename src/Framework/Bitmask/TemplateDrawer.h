@@ -64,11 +64,42 @@ namespace Egfx
 				{
 					PrimitiveShaderType::Prepare(x, y);
 
-					for (dimension_t row = 0; row < MaskHeight; row++)
+					// Trivial reject and row/byte limits from the clip rectangle and the transform's source bounds.
+					dimension_t firstColumn = 0;
+					dimension_t firstRow = 0;
+					dimension_t lastColumn = MaskWidth - 1;
+					dimension_t lastRow = MaskHeight - 1;
+					if (!PrimitiveShaderType::ClipBounds(firstColumn, firstRow, lastColumn, lastRow)
+						|| !PrimitiveShaderType::TransformShader.SourceBounds(firstColumn, firstRow, lastColumn, lastRow))
 					{
-						for (dimension_t xByte = 0; xByte < BytesPerLine; xByte++)
+						return;
+					}
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
+					{
+						dimension_t rowFirst = firstColumn;
+						dimension_t rowLast = lastColumn;
+						if (!PrimitiveShaderType::TransformShader.RowBounds(row, rowFirst, rowLast))
 						{
-							const uint8_t maskByte = MaskReader::template ReadByteAt<dimension_t, BytesPerLine>(mask, xByte, row);
+							continue;
+						}
+
+						const dimension_t firstByte = rowFirst / BitsPerByte;
+						const dimension_t lastByte = rowLast / BitsPerByte;
+
+						for (dimension_t xByte = firstByte; xByte <= lastByte; xByte++)
+						{
+							uint8_t maskByte = MaskReader::template ReadByteAt<dimension_t, BytesPerLine>(mask, xByte, row);
+
+							// Drop the edge bits outside the row limits.
+							if (xByte == firstByte)
+							{
+								maskByte &= static_cast<uint8_t>(UINT8_MAX >> (rowFirst % BitsPerByte));
+							}
+							if (xByte == lastByte)
+							{
+								maskByte &= static_cast<uint8_t>(UINT8_MAX << (BitsPerByte - 1 - (rowLast % BitsPerByte)));
+							}
 
 							if (maskByte == 0)
 							{
@@ -151,9 +182,24 @@ namespace Egfx
 				{
 					PrimitiveShaderType::Prepare(x, y);
 
-					for (dimension_t row = 0; row < MaskHeight; row++)
+					// Trivial reject and row/byte limits from the clip rectangle, in scaled local space.
+					int32_t firstX = 0;
+					int32_t firstY = 0;
+					int32_t lastX = (static_cast<int32_t>(MaskWidth) * ScaleX) - 1;
+					int32_t lastY = (static_cast<int32_t>(MaskHeight) * ScaleY) - 1;
+					if (!PrimitiveShaderType::ClipBounds(firstX, firstY, lastX, lastY))
+					{
+						return;
+					}
+
+					const dimension_t firstRow = static_cast<dimension_t>(firstY / ScaleY);
+					const dimension_t lastRow = static_cast<dimension_t>(lastY / ScaleY);
+					const dimension_t firstByte = static_cast<dimension_t>((firstX / ScaleX) / BitsPerByte);
+					const dimension_t lastByte = static_cast<dimension_t>((lastX / ScaleX) / BitsPerByte);
+
+					for (dimension_t row = firstRow; row <= lastRow; row++)
 					{
-						for (dimension_t xByte = 0; xByte < BytesPerLine; xByte++)
+						for (dimension_t xByte = firstByte; xByte <= lastByte; xByte++)
 						{
 							const uint8_t maskByte = MaskReader::template ReadByteAt<dimension_t, BytesPerLine>(mask, xByte, row);
 
@@ -60,6 +60,18 @@ namespace Egfx
 			static constexpr int16_t Width() { return width; }
 			static constexpr int16_t Height() { return height; }
 		};
+
+		/// <summary>
+		/// Pixel-space rectangle of a layout, with inclusive corners.
+		/// For clipping a drawable to its layout.
+		/// </summary>
+		/// <typeparam name="Layout">Layout type that provides X(), Y(), Width(), and Height().</typeparam>
+		template<typename Layout>
+		pixel_rectangle_t LayoutRectangle()
+		{
+			return { { Layout::X(), Layout::Y() },
+				{ static_cast<pixel_t>(Layout::X() + Layout::Width() - 1), static_cast<pixel_t>(Layout::Y() + Layout::Height() - 1) } };
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -44,7 +44,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -85,7 +85,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -125,7 +125,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -168,7 +168,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -210,7 +210,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -253,7 +253,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -295,7 +295,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -338,7 +338,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -380,7 +380,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -423,7 +423,7 @@ namespace Egfx
 						const dimension_t centerX, const dimension_t centerY,
 						const dimension_t radius)
 					{
-						if (radius <= 0)
+						if (radius <= 0 || !IsVisible(centerX, centerY, radius))
 						{
 							return;
 						}
@@ -455,6 +455,19 @@ namespace Egfx
 					}
 
 				private:
+					/// <summary>
+					/// Trivial reject of the full circle's bounding box against the clip rectangle.
+					/// </summary>
+					bool IsVisible(const dimension_t centerX, const dimension_t centerY, const dimension_t radius) const
+					{
+						int32_t x1 = static_cast<int32_t>(centerX) - radius;
+						int32_t y1 = static_cast<int32_t>(centerY) - radius;
+						int32_t x2 = static_cast<int32_t>(centerX) + radius;
+						int32_t y2 = static_cast<int32_t>(centerY) + radius;
+
+						return Base::ClipBounds(x1, y1, x2, y2);
+					}
+
 					/// <summary>
 					/// Emits the 8 symmetric outline points for a circle step at (px, py) relative to the center.
 					/// </summary>
@@ -31,6 +31,7 @@ namespace Egfx
 
 				protected:
 					using Base::PixelBlend;
+					using Base::PixelBlendRaw;
 
 				public:
 					using Base::ColorSource;
@@ -50,6 +51,12 @@ namespace Egfx
 						IntegerSignal::TypeTraits::TypeDispatch::FalseType,
 						Shader::Source::ConstantColorFlag<ColorSourceType>::value>::type;
 
+					// Compile-time dispatch: evaluate the source incrementally along horizontal spans, when supported.
+					using SpanSourceTag = typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+						IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+						IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+						Shader::Source::SpanSourceFlag<ColorSourceType>::value>::type;
+
 					using SkipShadeTag =
 						typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
 						IntegerSignal::TypeTraits::TypeDispatch::TrueType,
@@ -107,6 +114,16 @@ namespace Egfx
 						}
 						else
 						{
+							// Trivial reject of the bounding box, the remaining pixels are clip tested on write.
+							dimension_t minX = MinValue(x1, x2);
+							dimension_t minY = MinValue(y1, y2);
+							dimension_t maxX = MaxValue(x1, x2);
+							dimension_t maxY = MaxValue(y1, y2);
+							if (!Base::ClipBounds(minX, minY, maxX, maxY))
+							{
+								return;
+							}
+
 							const signed_t dx = AbsValue(static_cast<signed_t>(x2) - static_cast<signed_t>(x1));
 							const signed_t dy = AbsValue(static_cast<signed_t>(y2) - static_cast<signed_t>(y1));
 
@@ -143,12 +160,85 @@ namespace Egfx
 					// Horizontal line dispatch is selected at compile time based on:
 					// - whether the color source is constant (SkipSourceTag)
 					// - whether the transform shader is NoTransform (SkipTransformTag)
+					// - whether a non-constant source supports span evaluation (SpanSourceTag)
+					// Untransformed spans are clamped to the clip rectangle up front,
+					// transformed spans to the row range the transform may accept.
 					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
 						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::FalseType)
 					{
-						const dimension_t startX = MinValue(x1, x2);
-						const dimension_t endX = MaxValue(x1, x2);
+						dimension_t startX = MinValue(x1, x2);
+						dimension_t endX = MaxValue(x1, x2);
+						if (TransformShader.RowBounds(y, startX, endX))
+						{
+							LineHorizontalSource(framebuffer, startX, endX, y, SpanSourceTag{}, TypeTraits::TypeDispatch::FalseType{});
+						}
+					}
+
+					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
+						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::TrueType)
+					{
+						dimension_t startX = MinValue(x1, x2);
+						dimension_t endX = MaxValue(x1, x2);
+						dimension_t startY = y;
+						dimension_t endY = y;
+						if (Base::ClipBounds(startX, startY, endX, endY))
+						{
+							LineHorizontalSource(framebuffer, startX, endX, y, SpanSourceTag{}, TypeTraits::TypeDispatch::TrueType{});
+						}
+					}
+
+					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
+						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::TrueType)
+					{
+						dimension_t startX = MinValue(x1, x2);
+						dimension_t endX = MaxValue(x1, x2);
+						dimension_t startY = y;
+						dimension_t endY = y;
+						if (Base::ClipBounds(startX, startY, endX, endY))
+						{
+							framebuffer->LineHorizontal(ColorShader.Shade(ColorSource.Source(0, 0)),
+								static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(startX)),
+								static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(endX)),
+								static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(y)));
+						}
+					}
+
+					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
+						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::FalseType)
+					{
+						dimension_t startX = MinValue(x1, x2);
+						dimension_t endX = MaxValue(x1, x2);
+						if (!TransformShader.RowBounds(y, startX, endX))
+						{
+							return;
+						}
+
+						const rgb_color_t color = ColorShader.Shade(ColorSource.Source(0, 0));
+
+						dimension_t x = startX;
+						dimension_t fx, fy;
+						while (true)
+						{
+							fx = x;
+							fy = y;
+							if (TransformShader.Transform(fx, fy))
+							{
+								PixelBlend(framebuffer, color, fx, fy);
+							}
 
+							if (x == endX)
+							{
+								break;
+							}
+							x++;
+						}
+					}
+
+				private:
+					// SpanSource=False, SkipTransform=False: full pixel shader path.
+					inline void LineHorizontalSource(IFrameBuffer* framebuffer, const dimension_t startX, const dimension_t endX, const dimension_t y,
+						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::FalseType)
+					{
 						dimension_t x = startX;
 						while (true)
 						{
@@ -162,26 +252,35 @@ namespace Egfx
 						}
 					}
 
-					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
-						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::TrueType)
+					// SpanSource=False, SkipTransform=True: shade per pixel, no transform. Span is pre-clipped.
+					inline void LineHorizontalSource(IFrameBuffer* framebuffer, const dimension_t startX, const dimension_t endX, const dimension_t y,
+						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::TrueType)
 					{
-						framebuffer->LineHorizontal(ColorShader.Shade(ColorSource.Source(0, 0)),
-							static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(x1)),
-							static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(x2)),
-							static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(y)));
+						dimension_t x = startX;
+						while (true)
+						{
+							PixelBlendRaw(framebuffer, ColorShader.Shade(ColorSource.Source(x, y)), x, y);
+
+							if (x == endX)
+							{
+								break;
+							}
+							x++;
+						}
 					}
 
-					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
+					// SpanSource=True, SkipTransform=False: source stepped along the span, transform per pixel.
+					inline void LineHorizontalSource(IFrameBuffer* framebuffer, const dimension_t startX, const dimension_t endX, const dimension_t y,
 						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::FalseType)
 					{
-						const dimension_t startX = MinValue(x1, x2);
-						const dimension_t endX = MaxValue(x1, x2);
-						const rgb_color_t color = ColorShader.Shade(ColorSource.Source(0, 0));
+						ColorSource.SpanStart(startX, y);
 
 						dimension_t x = startX;
 						dimension_t fx, fy;
 						while (true)
 						{
+							const rgb_color_t color = ColorShader.Shade(ColorSource.SpanNext());
+
 							fx = x;
 							fy = y;
 							if (TransformShader.Transform(fx, fy))
@@ -197,16 +296,16 @@ namespace Egfx
 						}
 					}
 
-					inline void LineHorizontal(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t x2, const dimension_t y,
-						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::TrueType)
+					// SpanSource=True, SkipTransform=True: source stepped along the span, no transform. Span is pre-clipped.
+					inline void LineHorizontalSource(IFrameBuffer* framebuffer, const dimension_t startX, const dimension_t endX, const dimension_t y,
+						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::TrueType)
 					{
-						const dimension_t startX = MinValue(x1, x2);
-						const dimension_t endX = MaxValue(x1, x2);
+						ColorSource.SpanStart(startX, y);
 
 						dimension_t x = startX;
 						while (true)
 						{
-							PixelBlend(framebuffer, ColorShader.Shade(ColorSource.Source(x, y)), x, y);
+							PixelBlendRaw(framebuffer, ColorShader.Shade(ColorSource.SpanNext()), x, y);
 
 							if (x == endX)
 							{
@@ -216,14 +315,23 @@ namespace Egfx
 						}
 					}
 
+				protected:
 					// Vertical line dispatch is selected at compile time based on:
 					// - whether the color source is constant (SkipSourceTag)
 					// - whether the transform shader is NoTransform (SkipTransformTag)
+					// Untransformed spans are clamped to the clip rectangle up front,
+					// transformed spans to the source bounds the transform may accept.
 					inline void LineVertical(IFrameBuffer* framebuffer, const dimension_t x, const dimension_t y1, const dimension_t y2,
 						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::FalseType)
 					{
-						const dimension_t startY = MinValue(y1, y2);
-						const dimension_t endY = MaxValue(y1, y2);
+						dimension_t startX = x;
+						dimension_t endX = x;
+						dimension_t startY = MinValue(y1, y2);
+						dimension_t endY = MaxValue(y1, y2);
+						if (!TransformShader.SourceBounds(startX, startY, endX, endY))
+						{
+							return;
+						}
 
 						dimension_t y = startY;
 						while (true)
@@ -241,17 +349,31 @@ namespace Egfx
 					inline void LineVertical(IFrameBuffer* framebuffer, const dimension_t x, const dimension_t y1, const dimension_t y2,
 						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::TrueType)
 					{
-						framebuffer->LineVertical(ColorShader.Shade(ColorSource.Source(0, 0)),
-							static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(x)),
-							static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(y1)),
-							static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(y2)));
+						dimension_t startX = x;
+						dimension_t endX = x;
+						dimension_t startY = MinValue(y1, y2);
+						dimension_t endY = MaxValue(y1, y2);
+						if (Base::ClipBounds(startX, startY, endX, endY))
+						{
+							framebuffer->LineVertical(ColorShader.Shade(ColorSource.Source(0, 0)),
+								static_cast<pixel_t>(Base::Origin.x + static_cast<pixel_t>(x)),
+								static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(startY)),
+								static_cast<pixel_t>(Base::Origin.y + static_cast<pixel_t>(endY)));
+						}
 					}
 
 					inline void LineVertical(IFrameBuffer* framebuffer, const dimension_t x, const dimension_t y1, const dimension_t y2,
 						TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::FalseType)
 					{
-						const dimension_t startY = MinValue(y1, y2);
-						const dimension_t endY = MaxValue(y1, y2);
+						dimension_t startX = x;
+						dimension_t endX = x;
+						dimension_t startY = MinValue(y1, y2);
+						dimension_t endY = MaxValue(y1, y2);
+						if (!TransformShader.SourceBounds(startX, startY, endX, endY))
+						{
+							return;
+						}
+
 						const rgb_color_t color = ColorShader.Shade(ColorSource.Source(0, 0));
 
 						dimension_t y = startY;
@@ -276,13 +398,19 @@ namespace Egfx
 					inline void LineVertical(IFrameBuffer* framebuffer, const dimension_t x, const dimension_t y1, const dimension_t y2,
 						TypeTraits::TypeDispatch::FalseType, TypeTraits::TypeDispatch::TrueType)
 					{
-						const dimension_t startY = MinValue(y1, y2);
-						const dimension_t endY = MaxValue(y1, y2);
+						dimension_t startX = x;
+						dimension_t endX = x;
+						dimension_t startY = MinValue(y1, y2);
+						dimension_t endY = MaxValue(y1, y2);
+						if (!Base::ClipBounds(startX, startY, endX, endY))
+						{
+							return;
+						}
 
 						dimension_t y = startY;
 						while (true)
 						{
-							PixelBlend(framebuffer, ColorShader.Shade(ColorSource.Source(x, y)), x, y);
+							PixelBlendRaw(framebuffer, ColorShader.Shade(ColorSource.Source(x, y)), x, y);
 
 							if (y == endY)
 							{
@@ -87,7 +87,16 @@ namespace Egfx
 					void RectangleFill(IFrameBuffer* framebuffer, const dimension_t x1, const dimension_t y1,
 						const dimension_t x2, const dimension_t y2)
 					{
-						RectangleFill(framebuffer, x1, y1, x2, y2, SkipSourceTag{}, SkipTransformTag{});
+						// Clamp to the clip rectangle and the transform's source bounds up front.
+						dimension_t startX = MinValue(x1, x2);
+						dimension_t startY = MinValue(y1, y2);
+						dimension_t endX = MaxValue(x1, x2);
+						dimension_t endY = MaxValue(y1, y2);
+						if (Base::ClipBounds(startX, startY, endX, endY)
+							&& TransformShader.SourceBounds(startX, startY, endX, endY))
+						{
+							RectangleFill(framebuffer, startX, startY, endX, endY, SkipSourceTag{}, SkipTransformTag{});
+						}
 					}
 
 				private:
@@ -102,7 +111,7 @@ namespace Egfx
 						dimension_t y = startY;
 						while (true)
 						{
-							LineHorizontal(framebuffer, x1, x2, y, TypeTraits::TypeDispatch::FalseType{}, TypeTraits::TypeDispatch::FalseType{});
+							Base::LineHorizontal(framebuffer, x1, x2, y, TypeTraits::TypeDispatch::FalseType{}, TypeTraits::TypeDispatch::FalseType{});
 
 							if (y == endY)
 							{
@@ -123,7 +132,7 @@ namespace Egfx
 						dimension_t y = startY;
 						while (true)
 						{
-							LineHorizontal(framebuffer, x1, x2, y, TypeTraits::TypeDispatch::FalseType{}, TypeTraits::TypeDispatch::TrueType{});
+							Base::LineHorizontal(framebuffer, x1, x2, y, TypeTraits::TypeDispatch::FalseType{}, TypeTraits::TypeDispatch::TrueType{});
 
 							if (y == endY)
 							{
@@ -113,6 +113,16 @@ namespace Egfx
 							return;
 						}
 
+						// Trivial reject of the bounding box, then limit the scanlines to the clip rectangle.
+						signed_t minX = MinValue(ax, MinValue(bx, cx));
+						signed_t maxX = MaxValue(ax, MaxValue(bx, cx));
+						signed_t rowFirst = ay;
+						signed_t rowLast = cy;
+						if (!Base::ClipBounds(minX, rowFirst, maxX, rowLast))
+						{
+							return;
+						}
+
 						const signed_t hTop = by - ay;
 						const signed_t hBottom = cy - by;
 						const signed_t hTotal = cy - ay;
@@ -133,7 +143,7 @@ namespace Egfx
 							const signed_t stepLeft = longEdgeIsLeft ? dxLong : dxTop;
 							const signed_t stepRight = longEdgeIsLeft ? dxTop : dxLong;
 
-							FillTriangleSegment(framebuffer, ay, by, fxA, fxA, stepLeft, stepRight);
+							FillTriangleSegment(framebuffer, ay, by, fxA, fxA, stepLeft, stepRight, rowFirst, rowLast);
 						}
 
 						// Bottom segment [by, cy]
@@ -147,7 +157,7 @@ namespace Egfx
 							const bresenham_t fxLeft = longEdgeIsLeft ? fxLongAtB : fxB;
 							const bresenham_t fxRight = longEdgeIsLeft ? fxB : fxLongAtB;
 
-							FillTriangleSegment(framebuffer, by, cy, fxLeft, fxRight, stepLeft, stepRight);
+							FillTriangleSegment(framebuffer, by, cy, fxLeft, fxRight, stepLeft, stepRight, rowFirst, rowLast);
 						}
 					}
 
@@ -162,25 +172,30 @@ namespace Egfx
 					/// <param name="fxRight">Fixed-point x-coordinate of the right edge at yStart.</param>
 					/// <param name="stepLeft">Fixed-point increment of the left edge per scanline.</param>
 					/// <param name="stepRight">Fixed-point increment of the right edge per scanline.</param>
+					/// <param name="rowFirst">First visible scanline (clip top).</param>
+					/// <param name="rowLast">Last visible scanline (clip bottom).</param>
 					void FillTriangleSegment(IFrameBuffer* framebuffer,
 						signed_t yStart,
 						signed_t yEnd,
 						bresenham_t fxLeft,
 						bresenham_t fxRight,
 						const signed_t stepLeft,
-						const signed_t stepRight)
+						const signed_t stepRight,
+						const signed_t rowFirst,
+						const signed_t rowLast)
 					{
-						if (yStart < 0)
+						const signed_t firstY = MaxValue<signed_t>(rowFirst, 0);
+						if (yStart < firstY)
 						{
-							// Skip scanlines above the layout by advancing the fixed-point edges to the first scanline and setting yStart to 0.
-							const signed_t skipLines = -yStart;
+							// Skip scanlines above the layout or clip by advancing the fixed-point edges to the first visible scanline.
+							const signed_t skipLines = firstY - yStart;
 							fxLeft += stepLeft * skipLines;
 							fxRight += stepRight * skipLines;
-							yStart = 0;
+							yStart = firstY;
 						}
 
-						// Limit yEnd to avoid drawing outside the layout.
-						yEnd = MaxValue(yStart, yEnd);
+						// Limit yEnd to avoid drawing outside the layout or clip.
+						yEnd = MaxValue(yStart, MinValue<signed_t>(yEnd, rowLast + 1));
 
 						for (signed_t y = yStart; y < yEnd; y++)
 						{
@@ -0,0 +1,209 @@
+#ifndef _EGFX_FRAMEWORK_SHADER_PIXEL_CLIP_h
+#define _EGFX_FRAMEWORK_SHADER_PIXEL_CLIP_h
+
+#include "../../../EgfxCore.h"
+
+namespace Egfx
+{
+	namespace Framework
+	{
+		namespace Shader
+		{
+			namespace Pixel
+			{
+#if defined(EGFX_CLIP_RECTANGLE)
+				/// <summary>
+				/// Scissor rectangle in pixel-space, with inclusive corners.
+				/// Unbounded by default, the framebuffer still bounds-checks every write.
+				/// Lets drawers reject whole primitives and clamp their loops up front, instead of testing every pixel.
+				/// Opt-in with EGFX_CLIP_RECTANGLE, otherwise ClipRectangle is an empty base and every test folds away.
+				/// </summary>
+				class ClipRectangle
+				{
+				private:
+					static constexpr pixel_t PixelMin = TypeTraits::TypeLimits::type_limits<pixel_t>::Min();
+					static constexpr pixel_t PixelMax = TypeTraits::TypeLimits::type_limits<pixel_t>::Max();
+
+				protected:
+					pixel_rectangle_t Clip{ { PixelMin, PixelMin }, { PixelMax, PixelMax } };
+
+				public:
+					/// <summary>
+					/// Sets the clip rectangle, usually the owning view or layout bounds.
+					/// </summary>
+					/// <param name="clip">Pixel-space rectangle, inclusive.</param>
+					void SetClip(const pixel_rectangle_t& clip)
+					{
+						const pixel_rectangle_t sorted{
+							{ MinValue(clip.topLeft.x, clip.bottomRight.x), MinValue(clip.topLeft.y, clip.bottomRight.y) },
+							{ MaxValue(clip.topLeft.x, clip.bottomRight.x), MaxValue(clip.topLeft.y, clip.bottomRight.y) } };
+
+						Clip = sorted;
+					}
+
+					void ResetClip()
+					{
+						Clip = { { PixelMin, PixelMin }, { PixelMax, PixelMax } };
+					}
+
+					pixel_rectangle_t GetClip() const
+					{
+						return Clip;
+					}
+
+					/// <summary>
+					/// Tests a single pixel-space coordinate against the clip rectangle.
+					/// </summary>
+					bool ClipContains(const pixel_t x, const pixel_t y) const
+					{
+						return x >= Clip.topLeft.x && x <= Clip.bottomRight.x
+							&& y >= Clip.topLeft.y && y <= Clip.bottomRight.y;
+					}
+
+					/// <summary>
+					/// Clamps a sorted pixel-space area to the clip rectangle.
+					/// </summary>
+					/// <returns>False if the area is entirely outside the clip.</returns>
+					bool ClipArea(pixel_t& x1, pixel_t& y1, pixel_t& x2, pixel_t& y2) const
+					{
+						if (x2 < Clip.topLeft.x || x1 > Clip.bottomRight.x
+							|| y2 < Clip.topLeft.y || y1 > Clip.bottomRight.y)
+						{
+							return false;
+						}
+
+						x1 = MaxValue(x1, Clip.topLeft.x);
+						y1 = MaxValue(y1, Clip.topLeft.y);
+						x2 = MinValue(x2, Clip.bottomRight.x);
+						y2 = MinValue(y2, Clip.bottomRight.y);
+
+						return true;
+					}
+
+					/// <summary>
+					/// Clamps sorted local-space bounds to the clip rectangle, relative to a pixel-space origin.
+					/// Only valid for untransformed drawing, a transform may move pixels anywhere.
+					/// </summary>
+					/// <returns>False if the bounds are entirely outside the clip.</returns>
+					template<typename coordinate_t>
+					bool ClipLocal(const pixel_t originX, const pixel_t originY,
+						coordinate_t& x1, coordinate_t& y1, coordinate_t& x2, coordinate_t& y2) const
+					{
+						const int32_t minX = static_cast<int32_t>(Clip.topLeft.x) - originX;
+						const int32_t minY = static_cast<int32_t>(Clip.topLeft.y) - originY;
+						const int32_t maxX = static_cast<int32_t>(Clip.bottomRight.x) - originX;
+						const int32_t maxY = static_cast<int32_t>(Clip.bottomRight.y) - originY;
+
+						if (static_cast<int32_t>(x2) < minX || static_cast<int32_t>(x1) > maxX
+							|| static_cast<int32_t>(y2) < minY || static_cast<int32_t>(y1) > maxY)
+						{
+							return false;
+						}
+
+						// Clamped values lie within [x1, x2] / [y1, y2], so they fit coordinate_t.
+						if (static_cast<int32_t>(x1) < minX)
+						{
+							x1 = static_cast<coordinate_t>(minX);
+						}
+						if (static_cast<int32_t>(y1) < minY)
+						{
+							y1 = static_cast<coordinate_t>(minY);
+						}
+						if (static_cast<int32_t>(x2) > maxX)
+						{
+							x2 = static_cast<coordinate_t>(maxX);
+						}
+						if (static_cast<int32_t>(y2) > maxY)
+						{
+							y2 = static_cast<coordinate_t>(maxY);
+						}
+
+						return true;
+					}
+
+					/// <summary>
+					/// Compile-time dispatched ClipLocal(), for drawers with an optional transform.
+					/// TrueType: untransformed, clamps the bounds. FalseType: transformed, bounds unchanged.
+					/// </summary>
+					template<typename coordinate_t>
+					bool ClipLocal(const pixel_t originX, const pixel_t originY,
+						coordinate_t& x1, coordinate_t& y1, coordinate_t& x2, coordinate_t& y2, TypeTraits::TypeDispatch::TrueType) const
+					{
+						return ClipLocal(originX, originY, x1, y1, x2, y2);
+					}
+
+					template<typename coordinate_t>
+					bool ClipLocal(const pixel_t, const pixel_t,
+						coordinate_t&, coordinate_t&, coordinate_t&, coordinate_t&, TypeTraits::TypeDispatch::FalseType) const
+					{
+						return true;
+					}
+
+					/// <summary>
+					/// Compile-time dispatched ClipContains(), for drawers with an optional transform.
+					/// TrueType: untransformed, the loop bounds are already clamped. FalseType: transformed, tests the pixel.
+					/// </summary>
+					bool ClipContains(const pixel_t, const pixel_t, TypeTraits::TypeDispatch::TrueType) const
+					{
+						return true;
+					}
+
+					bool ClipContains(const pixel_t x, const pixel_t y, TypeTraits::TypeDispatch::FalseType) const
+					{
+						return ClipContains(x, y);
+					}
+				};
+#else
+				/// <summary>
+				/// Disabled clip rectangle, unbounded and without storage. Define EGFX_CLIP_RECTANGLE to enable clipping.
+				/// Same interface as the enabled one, every test passes and nothing is clamped.
+				/// </summary>
+				class ClipRectangle
+				{
+				public:
+					void SetClip(const pixel_rectangle_t& /*clip*/) {}
+
+					void ResetClip() {}
+
+					pixel_rectangle_t GetClip() const
+					{
+						return { { TypeTraits::TypeLimits::type_limits<pixel_t>::Min(), TypeTraits::TypeLimits::type_limits<pixel_t>::Min() },
+							{ TypeTraits::TypeLimits::type_limits<pixel_t>::Max(), TypeTraits::TypeLimits::type_limits<pixel_t>::Max() } };
+					}
+
+					bool ClipContains(const pixel_t, const pixel_t) const
+					{
+						return true;
+					}
+
+					bool ClipArea(pixel_t&, pixel_t&, pixel_t&, pixel_t&) const
+					{
+						return true;
+					}
+
+					template<typename coordinate_t>
+					bool ClipLocal(const pixel_t, const pixel_t,
+						coordinate_t&, coordinate_t&, coordinate_t&, coordinate_t&) const
+					{
+						return true;
+					}
+
+					template<typename coordinate_t, typename DispatchTag>
+					bool ClipLocal(const pixel_t, const pixel_t,
+						coordinate_t&, coordinate_t&, coordinate_t&, coordinate_t&, DispatchTag) const
+					{
+						return true;
+					}
+
+					template<typename DispatchTag>
+					bool ClipContains(const pixel_t, const pixel_t, DispatchTag) const
+					{
+						return true;
+					}
+				};
+#endif
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
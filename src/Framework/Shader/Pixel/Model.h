@@ -42,6 +42,18 @@ namespace Egfx
 						/// <param name="x">Local-space X coordinate.</param>
 						/// <param name="y">Local-space Y coordinate.</param>
 						void Pixel(IFrameBuffer* /*framebuffer*/, const dimension_t /*x*/, const dimension_t /*y*/) {}
+
+						/// <summary>
+						/// Clamps sorted local-space bounds to the shader's clip rectangle, for trivial reject and loop bounds.
+						/// </summary>
+						/// <returns>False if nothing inside the bounds can be visible.</returns>
+						template<typename coordinate_t>
+						bool ClipBounds(coordinate_t& /*x1*/, coordinate_t& /*y1*/, coordinate_t& /*x2*/, coordinate_t& /*y2*/) const { return true; }
+
+						/// <summary>
+						/// Sets the pixel-space clip rectangle. No-op unless EGFX_CLIP_RECTANGLE is defined.
+						/// </summary>
+						void SetClip(const pixel_rectangle_t& /*clip*/) {}
 					};
 				}
 			}
@@ -2,6 +2,7 @@
 #define _EGFX_FRAMEWORK_SHADER_PIXEL_SHADERS_h
 
 #include "Model.h"
+#include "Clip.h"
 
 namespace Egfx
 {
@@ -28,6 +29,8 @@ namespace Egfx
 				/// <summary>
 				/// Lowest-level shader stage that shades a single pixel.
 				/// Combines a color source, an optional color shader, and an optional transform shader, then writes to the framebuffer using the selected blend mode.
+				/// Carries a clip rectangle (opt-in with EGFX_CLIP_RECTANGLE): PixelBlend() tests every write against it,
+				/// geometry stages clamp untransformed primitives up front with ClipBounds() and write through PixelBlendRaw().
 				/// </summary>
 				/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
 				/// <typeparam name="ColorSourceType">Color source type providing Source(x, y).</typeparam>
@@ -40,7 +43,7 @@ namespace Egfx
 					typename TransformShaderType = Shader::Transform::NoTransform<dimension_t>,
 					BlendModeEnum BlendMode = BlendModeEnum::Replace
 				>
-				class TemplateShader
+				class TemplateShader : public ClipRectangle
 				{
 				public:
 					using color_source_t = ColorSourceType;
@@ -55,6 +58,14 @@ namespace Egfx
 						IntegerSignal::TypeTraits::TypeDispatch::FalseType,
 						IntegerSignal::TypeTraits::TypeDispatch::is_same<TransformShaderType, Shader::Transform::NoTransform<dimension_t>>::value>::type;
 
+					// Compile-time dispatch: clamp to the clip rectangle when the transform leaves coordinates unchanged (NoTransform, crops and masks).
+					using ClipBoundsTag =
+						typename IntegerSignal::TypeTraits::TypeConditional::conditional_type<
+						IntegerSignal::TypeTraits::TypeDispatch::TrueType,
+						IntegerSignal::TypeTraits::TypeDispatch::FalseType,
+						Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesX
+						&& Shader::Transform::CoordinateTraits<TransformShaderType>::PreservesY>::type;
+
 				public:
 					ColorSourceType ColorSource{};
 					ColorShaderType ColorShader{};
@@ -116,12 +127,35 @@ namespace Egfx
 						Pixel(framebuffer, x, y, SkipTransformTag{});
 					}
 
+					/// <summary>
+					/// Clamps sorted local-space bounds to the clip rectangle, for trivial reject and loop bounds.
+					/// With a transform shader that moves coordinates the bounds are left unchanged, as it may move pixels anywhere.
+					/// </summary>
+					/// <returns>False if nothing inside the bounds can be visible.</returns>
+					template<typename coordinate_t>
+					bool ClipBounds(coordinate_t& x1, coordinate_t& y1, coordinate_t& x2, coordinate_t& y2) const
+					{
+						return ClipLocal(Origin.x, Origin.y, x1, y1, x2, y2, ClipBoundsTag{});
+					}
+
 				protected:
 					/// <summary>
-					/// Writes a pre-shaded color using the selected blend mode.
+					/// Writes a pre-shaded color using the selected blend mode, if inside the clip rectangle.
 					/// Applies the prepared origin offset when addressing the framebuffer.
 					/// </summary>
 					inline void PixelBlend(IFrameBuffer* framebuffer, const rgb_color_t color, const dimension_t x, const dimension_t y)
+					{
+						if (ClipContains(static_cast<pixel_t>(Origin.x + x), static_cast<pixel_t>(Origin.y + y)))
+						{
+							PixelBlendRaw(framebuffer, color, x, y);
+						}
+					}
+
+					/// <summary>
+					/// Writes a pre-shaded color using the selected blend mode, without the clip test.
+					/// For coordinates already clamped with ClipBounds().
+					/// </summary>
+					inline void PixelBlendRaw(IFrameBuffer* framebuffer, const rgb_color_t color, const dimension_t x, const dimension_t y)
 					{
 						switch (BlendMode)
 						{
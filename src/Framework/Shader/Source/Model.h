@@ -28,6 +28,32 @@ namespace Egfx
 							return RGB_COLOR_BLACK;
 						}
 					};
+
+					/// <summary>
+					/// Optional span contract for color sources, evaluated incrementally along a horizontal span.
+					/// Sources flag support with IsSpanSource, fill loops then call SpanStart() once per span and SpanNext() per pixel.
+					/// This class serves as documentation only, and is not intended to be used directly.
+					/// </summary>
+					/// <typeparam name="dimension_t">The shader's intrinsic dimension type.</typeparam>
+					template<typename dimension_t>
+					struct SpanColorSource : ColorSource<dimension_t>
+					{
+						static constexpr bool IsSpanSource = true;
+
+						/// <summary>
+						/// Begins a span at (x, y).
+						/// </summary>
+						void SpanStart(const dimension_t /*x*/, const dimension_t /*y*/) {}
+
+						/// <summary>
+						/// Returns the color of the current pixel and steps one pixel right.
+						/// Must match Source(x, y) for the same pixel, give or take gamma rounding.
+						/// </summary>
+						rgb_color_t SpanNext()
+						{
+							return RGB_COLOR_BLACK;
+						}
+					};
 				}
 			}
 		}
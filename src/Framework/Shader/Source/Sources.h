@@ -62,6 +62,23 @@ namespace Egfx
 				{
 					static constexpr bool value = true;
 				};
+
+				/// <summary>
+				/// Compile-time extractor for ColorSourceType::IsSpanSource.
+				/// Defaults to false when the member does not exist.
+				/// </summary>
+				template<typename T, typename = void>
+				struct SpanSourceFlag
+				{
+					static constexpr bool value = false;
+				};
+
+				template<typename T>
+				struct SpanSourceFlag<T,
+					typename IntegerSignal::TypeTraits::TypeEnableIf::enable_if<(T::IsSpanSource), void>::type>
+				{
+					static constexpr bool value = true;
+				};
 			}
 		}
 	}
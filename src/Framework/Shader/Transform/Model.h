@@ -36,6 +36,46 @@ namespace Egfx
 					{
 						return true;
 					}
+
+					/// <summary>
+					/// Narrows sorted local-space source bounds to the region the transform chain may accept.
+					/// Conservative: every accepted source pixel must remain inside the bounds.
+					/// </summary>
+					/// <returns>False if no source pixel inside the bounds is accepted.</returns>
+					static constexpr bool SourceBounds(dimension_t& /*x1*/, dimension_t& /*y1*/, dimension_t& /*x2*/, dimension_t& /*y2*/)
+					{
+						return true;
+					}
+
+					/// <summary>
+					/// Narrows a sorted local-space column range of source row y, like SourceBounds().
+					/// </summary>
+					/// <returns>False if the whole row is rejected.</returns>
+					static constexpr bool RowBounds(const dimension_t /*y*/, dimension_t& /*x1*/, dimension_t& /*x2*/)
+					{
+						return true;
+					}
+				};
+
+				/// <summary>
+				/// Whether a transform chain leaves the X/Y coordinates of accepted pixels unchanged.
+				/// Bounds are published in the drawer's source space, so a transform only narrows them
+				/// on the axes its Base chain preserves.
+				/// Unknown transforms are assumed to move coordinates, specialize for pass-through transforms.
+				/// </summary>
+				/// <typeparam name="TransformType">The transform chain type.</typeparam>
+				template<typename TransformType>
+				struct CoordinateTraits
+				{
+					static constexpr bool PreservesX = false;
+					static constexpr bool PreservesY = false;
+				};
+
+				template<typename dimension_t>
+				struct CoordinateTraits<BaseTransform<dimension_t>>
+				{
+					static constexpr bool PreservesX = true;
+					static constexpr bool PreservesY = true;
 				};
 
 				namespace Contract
@@ -70,6 +110,19 @@ namespace Egfx
 							// Return true to continue processing.
 							return true;
 						}
+
+						// Optional, narrows the source loop bounds to what Transform() may accept.
+						// Only narrow the axes preserved by the Base chain, see CoordinateTraits.
+						bool SourceBounds(dimension_t& x1, dimension_t& y1, dimension_t& x2, dimension_t& y2) const
+						{
+							return Base::SourceBounds(x1, y1, x2, y2);
+						}
+
+						// Optional, narrows the column range of a source row, false to skip the row.
+						bool RowBounds(const dimension_t y, dimension_t& x1, dimension_t& x2) const
+						{
+							return Base::RowBounds(y, x1, x2);
+						}
 					};
 				}
 			}
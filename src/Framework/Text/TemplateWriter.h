@@ -2,6 +2,7 @@
 #define _EGFX_FRAMEWORK_TEXT_TEMPLATE_WRITER_h
 
 #include "Model.h"
+#include "../Layout/Model.h"
 
 namespace Egfx
 {
@@ -46,6 +47,11 @@ namespace Egfx
 					{
 						return 0;
 					}
+
+					/// <summary>
+					/// Sets the pixel-space clip rectangle that glyphs are drawn into.
+					/// </summary>
+					void SetClip(const pixel_rectangle_t& /*clip*/) {}
 				};
 			}
 
@@ -66,6 +72,7 @@ namespace Egfx
 			///   - Space: advances cursor using GetSpaceWidth()
 			/// - Printable glyphs use the underlying font drawer (Advance/Draw).
 			/// - When out of bounds, glyphs are not drawn but the cursor still advances.
+			/// - With EGFX_CLIP_RECTANGLE, glyphs straddling the layout edge are clipped to it.
 			/// </summary>
 			/// <typeparam name="Layout">Layout type that provides X(), Y(), Width(), and Height().</typeparam>
 			/// <typeparam name="FontDrawerType">Font drawer implementation providing font metrics and Draw/Advance.</typeparam>
@@ -80,7 +87,10 @@ namespace Egfx
 				using dimension_t = typename FontDrawerType::dimension_t;
 
 			public:
-				TemplateWriter() : Base() {}
+				TemplateWriter() : Base()
+				{
+					Base::SetClip(LayoutRectangle<Layout>());
+				}
 
 				~TemplateWriter() = default;
 
@@ -43,6 +43,18 @@ namespace Egfx
 		}
 	};
 
+	struct AbstractColorConverter12
+	{
+		using color_t = uint16_t;
+		static constexpr uint8_t ColorDepth = 12;
+		static constexpr bool Monochrome = false;
+
+		static constexpr size_t BufferSize(const uint16_t width, const uint16_t height)
+		{
+			return GetFrameBufferColor12Size(width, height);
+		}
+	};
+
 	struct AbstractColorConverter16
 	{
 		using color_t = uint16_t;
@@ -99,6 +111,34 @@ namespace Egfx
 #endif
 	};
 
+	/// <summary>
+	/// Converter for 12 bit color, 4-4-4 color format.
+	/// </summary>
+	struct ColorConverter12 : public AbstractColorConverter12
+	{
+#if defined(EGFX_PLATFORM_HDR)
+		/// <summary>
+		/// Convert 8-8-8 color to 4-4-4 color.
+		/// </summary>
+		/// <param name="color">EGFX-native color (8-8-8).</param>
+		/// <returns>Framebuffer-native color (4-4-4).</returns>
+		static constexpr color_t GetRawColor(const rgb_color_t color)
+		{
+			return Rgb::Color444From888(color);
+		}
+#else
+		/// <summary>
+		/// Convert 5-6-5 color to 4-4-4 color.
+		/// </summary>
+		/// <param name="color">EGFX-native color (5-6-5).</param>
+		/// <returns>Framebuffer-native color (4-4-4).</returns>
+		static constexpr color_t GetRawColor(const rgb_color_t color)
+		{
+			return Rgb::Color444From565(color);
+		}
+#endif
+	};
+
 	/// <summary>
 	/// Converter for 16 bit color, 5-6-5 color format.
 	/// </summary>
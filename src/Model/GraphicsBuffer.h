@@ -17,6 +17,14 @@ namespace Egfx
 		return (size_t)width * (height / colorDivisor);
 	}
 
+	/// <summary>
+	/// Packed 12 bit color: 2 pixels every 3 bytes, pixels contiguous across rows.
+	/// </summary>
+	static constexpr size_t GetFrameBufferColor12Size(const uint16_t width, const uint16_t height)
+	{
+		return (((size_t)width * height * 3) + 1) / 2;
+	}
+
 	static constexpr size_t GetFrameBufferMonochromeSize(const uint16_t width, const uint16_t height)
 	{
 		return GetFrameBufferLowColorSize<8>(width, height);
@@ -101,6 +101,21 @@ namespace Egfx
 		/// <param name="color">The fill color.</param>
 		virtual void RectangleFill(const rgb_color_t color, const pixel_t topLeftX, const pixel_t topLeftY, const pixel_t bottomRightX, const pixel_t bottomRightY) = 0;
 		virtual void RectangleFill(const rgb_color_t color, const pixel_rectangle_t& rectangle) = 0;
+
+		/// <summary>
+		/// Copy a row of 5-6-5 colors, starting at (x, y). Optional fast path for bitmap drawers.
+		/// Only framebuffers that store the colors unchanged in a row support it, others return false without drawing.
+		/// </summary>
+		/// <param name="colors">Row of 5-6-5 colors, in RAM.</param>
+		/// <param name="count">Number of colors in the row.</param>
+		/// <param name="keyed">Skip colors matching keyColor when true.</param>
+		/// <param name="keyColor">Transparent key color (5-6-5).</param>
+		/// <returns>False if the framebuffer has no row copy, the caller must draw the pixels instead.</returns>
+		virtual bool RowCopy565(const uint16_t* /*colors*/, const pixel_t /*x*/, const pixel_t /*y*/, const pixel_t /*count*/,
+			const bool /*keyed*/, const uint16_t /*keyColor*/)
+		{
+			return false;
+		}
 	};
 }
 #endif
\ No newline at end of file
@@ -48,6 +48,22 @@ namespace Egfx
 		virtual void SetBufferTaskCallback(void (*taskCallback)(void* parameter)) = 0;
 
 		virtual void BufferTaskCallback(void* parameter) = 0;
+
+		/// <summary>
+		/// Optional push progress notification.
+		/// Drivers that support it call pushCallback(parameter) once for every PushingBuffer() step that has work to do
+		/// (DMA chunk or transfer complete, worker task done), possibly from interrupt context.
+		/// The callback must only count the signal.
+		/// </summary>
+		/// <returns>True if the driver will signal, false if PushingBuffer() must be polled.</returns>
+		virtual bool SetPushCallback(void (*pushCallback)(void* parameter), void* parameter) = 0;
+
+		/// <summary>
+		/// Bytes of the pushing buffer already transmitted, from the start, that the driver will not read again.
+		/// Lets the engine clear them while the rest is still being pushed.
+		/// </summary>
+		/// <returns>0 if unknown.</returns>
+		virtual size_t GetPushedSize() = 0;
 	};
 
 	// Pure virtual to keep interface abstract even if other methods change.
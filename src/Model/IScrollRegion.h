@@ -0,0 +1,30 @@
+#ifndef _EGFX_I_SCROLL_REGION_h
+#define _EGFX_I_SCROLL_REGION_h
+
+#include "../Platform/Platform.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Optional hardware scroll of a band of screen rows, provided by screen drivers that keep display RAM between frames.
+	/// Views that scroll their content report it, so the driver can move display RAM instead of pushing the rows again.
+	/// The rendered frame must still show the scrolled content, the scroll only saves bus traffic.
+	/// </summary>
+	struct IScrollRegion
+	{
+		/// <summary>
+		/// Sets the scroll region, in screen rows.
+		/// </summary>
+		/// <param name="top">First row of the scroll region.</param>
+		/// <param name="height">Number of rows in the scroll region, 0 to disable scrolling.</param>
+		/// <returns>False if the region is not supported.</returns>
+		virtual bool SetScrollRegion(const pixel_t top, const pixel_t height) = 0;
+
+		/// <summary>
+		/// Scrolls the scroll region.
+		/// </summary>
+		/// <param name="lines">Positive moves content up, negative moves content down.</param>
+		virtual void Scroll(const int16_t lines) = 0;
+	};
+}
+#endif
\ No newline at end of file
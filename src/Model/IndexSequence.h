@@ -0,0 +1,45 @@
+#ifndef _EGFX_INDEX_SEQUENCE_h
+#define _EGFX_INDEX_SEQUENCE_h
+
+#include "../Platform/Platform.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// C++11 compile time index sequence, for generating constexpr tables from a pack expansion.
+	/// </summary>
+	template<uint16_t... Indexes>
+	struct IndexSequence {};
+
+	template<typename Low, typename High>
+	struct MergeIndexSequence;
+
+	template<uint16_t... Low, uint16_t... High>
+	struct MergeIndexSequence<IndexSequence<Low...>, IndexSequence<High...>>
+	{
+		using type = IndexSequence<Low..., (sizeof...(Low) + High)...>;
+	};
+
+	/// <summary>
+	/// IndexSequence of [0, Count), with logarithmic template depth.
+	/// </summary>
+	template<uint16_t Count>
+	struct MakeIndexSequence
+	{
+		using type = typename MergeIndexSequence<typename MakeIndexSequence<Count / 2>::type,
+			typename MakeIndexSequence<Count - (Count / 2)>::type>::type;
+	};
+
+	template<>
+	struct MakeIndexSequence<0>
+	{
+		using type = IndexSequence<>;
+	};
+
+	template<>
+	struct MakeIndexSequence<1>
+	{
+		using type = IndexSequence<0>;
+	};
+}
+#endif
\ No newline at end of file
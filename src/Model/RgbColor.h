@@ -2,6 +2,7 @@
 #define _EGFX_RGB_COLOR_h
 
 #include "../Platform/Platform.h"
+#include "RgbGamma.h"
 
 namespace Egfx
 {
@@ -88,6 +89,30 @@ namespace Egfx
 			return color & 0b11;
 		}
 
+		/// <summary>
+		/// Red 4-bit component of 12-bit color (0x0RGB).
+		/// </summary>
+		inline constexpr uint8_t R4(const uint16_t color)
+		{
+			return (color >> 8) & 0b1111;
+		}
+
+		/// <summary>
+		/// Green 4-bit component of 12-bit color (0x0RGB).
+		/// </summary>
+		inline constexpr uint8_t G4(const uint16_t color)
+		{
+			return (color >> 4) & 0b1111;
+		}
+
+		/// <summary>
+		/// Blue 4-bit component of 12-bit color (0x0RGB).
+		/// </summary>
+		inline constexpr uint8_t B4(const uint16_t color)
+		{
+			return color & 0b1111;
+		}
+
 		/// <summary>
 		/// Red 8-bit component of 24-bit color.
 		/// </summary>
@@ -195,6 +220,48 @@ namespace Egfx
 			return (r << 5) | (g << 2) | b;
 		}
 
+		/// <summary>
+		/// Convert 4-bit components to 12-bit color value (0x0RGB).
+		/// </summary>
+		inline constexpr uint16_t Color444From444(const uint8_t r, const uint8_t g, const uint8_t b)
+		{
+			return ((uint16_t)r << 8) | ((uint16_t)g << 4) | b;
+		}
+
+		/// <summary>
+		/// Convert 8-8-8 color to 4-4-4.
+		/// </summary>
+		inline constexpr uint16_t Color444From888(const uint8_t r, const uint8_t g, const uint8_t b)
+		{
+			return Color444From444(r >> 4, g >> 4, b >> 4);
+		}
+
+		/// <summary>
+		/// Convert 8-8-8 packed color to 4-4-4.
+		/// </summary>
+		inline constexpr uint16_t Color444From888(const uint32_t color)
+		{
+			return Color444From888(R8(color), G8(color), B8(color));
+		}
+
+		/// <summary>
+		/// Convert 5-6-5 color to 4-4-4.
+		/// </summary>
+		inline constexpr uint16_t Color444From565(const uint16_t color)
+		{
+			return Color444From444(R5(color) >> 1, G6(color) >> 2, B5(color) >> 1);
+		}
+
+		/// <summary>
+		/// Convert 3-3-2 color to 4-4-4.
+		/// </summary>
+		inline constexpr uint16_t Color444From332(const uint8_t color)
+		{
+			return Color444From444((R3(color) << 1) | (R3(color) >> 2),
+				(G3(color) << 1) | (G3(color) >> 2),
+				(B2(color) << 2) | B2(color));
+		}
+
 		/// <summary>
 		/// Convert 8-8-8 color to 3-3-2.
 		/// </summary>
@@ -387,9 +454,9 @@ namespace Egfx
 		template<typename ufraction_t, typename color_t>
 		inline color_t Interpolate(const ufraction_t fraction, const color_t from, const color_t to)
 		{
-			return Rgb::Color(SquareRoot16(UFraction16::Interpolate(fraction, Power8(R(from)), Power8(R(to)))),
-				SquareRoot16(UFraction16::Interpolate(fraction, Power8(G(from)), Power8(G(to)))),
-				SquareRoot16(UFraction16::Interpolate(fraction, Power8(B(from)), Power8(B(to)))));
+			return Rgb::Color(GammaEncode(UFraction16::Interpolate(fraction, Power8(R(from)), Power8(R(to)))),
+				GammaEncode(UFraction16::Interpolate(fraction, Power8(G(from)), Power8(G(to)))),
+				GammaEncode(UFraction16::Interpolate(fraction, Power8(B(from)), Power8(B(to)))));
 		}
 	};
 
@@ -0,0 +1,114 @@
+#ifndef _EGFX_RGB_GAMMA_h
+#define _EGFX_RGB_GAMMA_h
+
+#include "../Platform/Platform.h"
+#include "IndexSequence.h"
+
+/// <summary>
+/// Gamma encode table precision, in bits of the 16 bit linear value.
+/// Table size is 2^bits bytes. Fewer bits take more correction steps per lookup.
+/// </summary>
+#if !defined(EGFX_GAMMA_LUT_BITS)
+#define EGFX_GAMMA_LUT_BITS 10
+#endif
+
+namespace Egfx
+{
+	namespace Rgb
+	{
+		/// <summary>
+		/// Gamma 2 color space helpers.
+		/// Decode is the channel squared (Power8), a single multiply is cheaper than a table read on every target.
+		/// Encode is the floor square root, with a compile time table indexed by the top bits of the linear value,
+		/// followed by exact correction steps.
+		///
+		/// EGFX_GAMMA_LUT selects the table encode for color interpolation, SquareRoot16 otherwise.
+		/// Output is identical in both modes.
+		/// </summary>
+		namespace Gamma
+		{
+			static constexpr uint8_t TableBits = EGFX_GAMMA_LUT_BITS;
+
+			static_assert(TableBits >= 6 && TableBits <= 12, "EGFX_GAMMA_LUT_BITS must be in [6, 12].");
+
+			static constexpr uint16_t TableSize = uint16_t(1) << TableBits;
+			static constexpr uint8_t TableShift = 16 - TableBits;
+
+			namespace Lut
+			{
+				/// <summary>
+				/// Compile time floor square root, binary search in [low, high].
+				/// </summary>
+				inline constexpr uint8_t RootSearch(const uint16_t value, const uint16_t low, const uint16_t high)
+				{
+					return (low >= high) ? uint8_t(low)
+						: ((uint32_t(((low + high + 1) / 2)) * ((low + high + 1) / 2) <= value)
+							? RootSearch(value, (low + high + 1) / 2, high)
+							: RootSearch(value, low, ((low + high + 1) / 2) - 1));
+				}
+
+				template<typename Sequence>
+				struct EncodeTable;
+
+				/// <summary>
+				/// Floor square root of each bucket's lowest linear value.
+				/// </summary>
+				template<uint16_t... Indexes>
+				struct EncodeTable<IndexSequence<Indexes...>>
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					static constexpr uint8_t Table[sizeof...(Indexes)] PROGMEM = { RootSearch(uint16_t(Indexes << TableShift), 0, UINT8_MAX)... };
+#else
+					static constexpr uint8_t Table[sizeof...(Indexes)] = { RootSearch(uint16_t(Indexes << TableShift), 0, UINT8_MAX)... };
+#endif
+				};
+
+				template<uint16_t... Indexes>
+				constexpr uint8_t EncodeTable<IndexSequence<Indexes...>>::Table[sizeof...(Indexes)];
+
+				using Roots = EncodeTable<typename MakeIndexSequence<TableSize>::type>;
+			}
+
+			/// <summary>
+			/// Gamma decode, 8 bit channel to 16 bit linear.
+			/// </summary>
+			inline constexpr uint16_t Decode(const uint8_t value)
+			{
+				return static_cast<uint16_t>(value) * value;
+			}
+
+			/// <summary>
+			/// Gamma encode, 16 bit linear to 8 bit channel. Same result as SquareRoot16.
+			/// </summary>
+			inline uint8_t Encode(const uint16_t linear)
+			{
+#if defined(ARDUINO_ARCH_AVR)
+				uint8_t root = pgm_read_byte(&Lut::Roots::Table[linear >> TableShift]);
+#else
+				uint8_t root = Lut::Roots::Table[linear >> TableShift];
+#endif
+				// Table holds the root of the bucket's start, step up to the exact root.
+				while (root < UINT8_MAX
+					&& Decode(root + 1) <= linear)
+				{
+					root++;
+				}
+
+				return root;
+			}
+		}
+
+		/// <summary>
+		/// Gamma encode of interpolated linear values, as selected by EGFX_GAMMA_LUT.
+		/// </summary>
+		inline uint8_t GammaEncode(const uint16_t linear)
+		{
+#if defined(EGFX_GAMMA_LUT)
+			return Gamma::Encode(linear);
+#else
+			return SquareRoot16(linear);
+#endif
+		}
+	}
+}
+#endif
\ No newline at end of file
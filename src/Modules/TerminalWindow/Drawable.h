@@ -67,6 +67,7 @@ namespace Egfx
 				private:
 					uint32_t LastNewLineTime = 0;
 					uint32_t LastCursorTime = 0;
+					uint16_t NewLineCount = 0;
 					pixel_t CursorX = 0;
 
 				public:
@@ -112,6 +113,14 @@ namespace Egfx
 						return micros() - LastNewLineTime;
 					}
 
+					/// <summary>
+					/// Number of new lines so far, wrapping.
+					/// </summary>
+					uint16_t GetNewLineCount() const
+					{
+						return NewLineCount;
+					}
+
 					void Clear()
 					{
 						memset(TextBuffer, static_cast<uint8_t>(AsciiDefinition::Control::NUL), sizeof(TextBuffer));
@@ -177,6 +186,7 @@ namespace Egfx
 						}
 
 						CursorX = 0; // Reset cursor X.
+						NewLineCount++;
 						OffsetY = FontHeight; // Start offset for animation.
 						LastNewLineTime = micros(); // Update new line time.
 						LastCursorTime = LastNewLineTime; // Update cursor time to prevent blinking during animation.
@@ -15,6 +15,7 @@ namespace Egfx
 			{
 				/// <summary>
 				/// A view component that displays serial text output using a specified layout and font drawer.
+				/// Optionally reports its line scrolls to the screen driver's hardware scroll, see SetScrollTarget().
 				/// </summary>
 				/// <typeparam name="ParentLayout">The layout type that defines how the text view is positioned and sized.</typeparam>
 				/// <typeparam name="FontDrawerType">The type responsible for rendering font glyphs. Defaults to Definitions::DefaultFontDrawer.</typeparam>
@@ -42,6 +43,13 @@ namespace Egfx
 				private:
 					DrawableType Drawable{};
 
+				private:
+					static constexpr uint16_t LineHeight = FontHeight + LineSpacing;
+
+				private:
+					IScrollRegion* ScrollTarget = nullptr;
+					uint16_t ScrollPosition = 0;
+
 				private:
 					uint8_t CallIndex = 0;
 
@@ -62,6 +70,38 @@ namespace Egfx
 						return Drawable.TextWriter;
 					}
 
+					/// <summary>
+					/// Sets the layout rows as the target's scroll region and reports each frame's content scroll to it.
+					/// Requires a framebuffer whose rows are the screen driver's rows (no rotation or mirroring).
+					/// Only scrolls in whole row hash blocks save pushes: set AnimationDuration to 0,
+					/// with the layout's Y and FontHeight + LineSpacing aligned to the driver's rows per block.
+					/// </summary>
+					/// <param name="scrollTarget">Screen driver with hardware scroll, nullptr to stop reporting.</param>
+					/// <returns>False if the target doesn't support the layout rows as a scroll region.</returns>
+					bool SetScrollTarget(IScrollRegion* scrollTarget)
+					{
+						if (ScrollTarget != nullptr)
+						{
+							ScrollTarget->SetScrollRegion(0, 0);
+							ScrollTarget = nullptr;
+						}
+
+						if (scrollTarget == nullptr)
+						{
+							return true;
+						}
+
+						if (!scrollTarget->SetScrollRegion(ParentLayout::Y(), ParentLayout::Height()))
+						{
+							return false;
+						}
+
+						ScrollTarget = scrollTarget;
+						ScrollPosition = GetScrollPosition();
+
+						return true;
+					}
+
 				protected:
 					bool ViewStep(const uint32_t /*frameTime*/, const uint16_t /*frameCounter*/) override
 					{
@@ -77,6 +117,15 @@ namespace Egfx
 							// Animation complete - reset offset Y.
 							Drawable.OffsetY = 0;
 						}
+
+						if (ScrollTarget != nullptr)
+						{
+							// Content moves up by a line height per new line, less the animation offset.
+							const uint16_t position = GetScrollPosition();
+							ScrollTarget->Scroll(static_cast<int16_t>(position - ScrollPosition));
+							ScrollPosition = position;
+						}
+
 						return true;
 					}
 
@@ -92,6 +141,12 @@ namespace Egfx
 						}
 						return false;
 					}
+
+				private:
+					uint16_t GetScrollPosition() const
+					{
+						return static_cast<uint16_t>((Drawable.GetNewLineCount() * LineHeight) - Drawable.OffsetY);
+					}
 				};
 			}
 		}
@@ -8,6 +8,9 @@
 
 #if defined(ARDUINO)
 #include <Arduino.h>
+#else
+#include <stddef.h>
+#include <string.h>
 #endif
 
 /// <summary>
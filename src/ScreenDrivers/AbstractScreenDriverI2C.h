@@ -2,15 +2,27 @@
 #define _ABSTRACT_SCREEN_DRIVER_I2C_h
 
 #include "../Model/IScreenDriver.h"
+#include "InitSequence.h"
 
+#if defined(ARDUINO)
 #include <Wire.h>
+#else
+#include "Mock/MockWire.h"
+#endif
 
 namespace Egfx
 {
+#if defined(ARDUINO)
 	/// <summary>
 	/// Platform I2C type.
 	/// </summary>
 	using WireType = TwoWire;
+#else
+	/// <summary>
+	/// Host mock I2C, for driver benchmarks and tests without hardware.
+	/// </summary>
+	using WireType = MockWire;
+#endif
 
 	// Selector for the screen communications hardware instance.
 	template<> struct InterfaceSelector<InterfaceTypeEnum::I2C>
@@ -37,6 +49,17 @@ namespace Egfx
 	protected:
 		WireType& WireInstance;
 
+	private:
+		// Arduino Wire buffers 32 bytes, one is taken by the control byte.
+		static constexpr uint8_t SEQUENCE_CHUNK_SIZE = 31;
+
+		// Control byte for a stream of command bytes.
+		static constexpr uint8_t SEQUENCE_COMMAND_CONTROL = 0x00;
+
+		const uint8_t* Sequence = nullptr;
+		uint32_t SequenceStart = 0;
+		uint32_t SequenceWait = 0;
+
 	public:
 		AbstractScreenDriverI2C(WireType& wire)
 			: IScreenDriver()
@@ -48,12 +71,28 @@ namespace Egfx
 
 		virtual void BufferTaskCallback(void* /*parameter*/) {}
 		virtual void SetBufferTaskCallback(void (*/*taskCallback*/)(void* parameter)) {}
+		virtual bool SetPushCallback(void (*/*pushCallback*/)(void* parameter), void* /*parameter*/) { return false; }
+		virtual size_t GetPushedSize() { return 0; }
 
 		virtual bool Start()
 		{
 			return true;
 		}
 
+		virtual void Stop()
+		{
+			Sequence = nullptr;
+			WireInstance.end();
+		}
+
+		/// <summary>
+		/// Steps the init sequence, if running. Push is only available once it has completed.
+		/// </summary>
+		virtual bool CanPushBuffer()
+		{
+			return InitSequenceStep();
+		}
+
 		virtual pixel_t GetScreenWidth() const final
 		{
 			return ScreenWidth;
@@ -63,6 +102,94 @@ namespace Egfx
 		{
 			return ScreenHeight;
 		}
+
+	protected:
+		/// <summary>
+		/// Starts a non-blocking init sequence, stepped on every CanPushBuffer() call.
+		/// </summary>
+		/// <param name="sequence">InitSequence byte stream, in PROGMEM.</param>
+		void StartInitSequence(const uint8_t* sequence)
+		{
+			Sequence = sequence;
+			SequenceWait = 0;
+		}
+
+		/// <summary>
+		/// Runs the init sequence up to the next wait.
+		/// </summary>
+		/// <returns>True when no sequence is running.</returns>
+		bool InitSequenceStep()
+		{
+			if (Sequence == nullptr)
+			{
+				return true;
+			}
+
+			if (SequenceWait > 0)
+			{
+				if ((micros() - SequenceStart) < SequenceWait)
+				{
+					return false;
+				}
+				SequenceWait = 0;
+			}
+
+			while (Sequence != nullptr && SequenceWait == 0)
+			{
+				const uint8_t header = InitSequence::Read(Sequence);
+				if (header <= InitSequence::MaxLength)
+				{
+					SequenceWrite(&Sequence[1], 1 + header);
+					Sequence += 2 + header;
+				}
+				else if (header >= InitSequence::Commands && header <= InitSequence::Commands + InitSequence::MaxCommands)
+				{
+					SequenceWrite(&Sequence[1], header - InitSequence::Commands);
+					Sequence += 1 + header - InitSequence::Commands;
+				}
+				else
+				{
+					switch (header)
+					{
+					case InitSequence::Delay:
+					case InitSequence::Reset:
+						SequenceWait = InitSequence::PeriodMicros(InitSequence::Read(&Sequence[1]), InitSequence::Read(&Sequence[2]));
+						Sequence += 3;
+						break;
+					case InitSequence::End:
+					default:
+						Sequence = nullptr;
+						break;
+					}
+
+					SequenceStart = micros();
+				}
+			}
+
+			return Sequence == nullptr;
+		}
+
+	private:
+		/// <summary>
+		/// Writes sequence bytes in command mode transmissions, within the Wire buffer.
+		/// </summary>
+		void SequenceWrite(const uint8_t* data, const uint8_t size)
+		{
+			uint8_t offset = 0;
+			while (offset < size)
+			{
+				const uint8_t count = ((size - offset) > SEQUENCE_CHUNK_SIZE) ? SEQUENCE_CHUNK_SIZE : (size - offset);
+
+				WireInstance.beginTransmission(I2CAddress);
+				WireInstance.write(SEQUENCE_COMMAND_CONTROL);
+				for (uint8_t i = 0; i < count; i++)
+				{
+					WireInstance.write(InitSequence::Read(&data[offset + i]));
+				}
+				WireInstance.endTransmission();
+				offset += count;
+			}
+		}
 	};
 }
 #endif
\ No newline at end of file
@@ -2,8 +2,14 @@
 #define _ABSTRACT_SCREEN_DRIVER_SPI_h
 
 #include "../Model/IScreenDriver.h"
+#include "GpioPin.h"
+#include "InitSequence.h"
 
+#if defined(ARDUINO)
 #include <SPI.h>
+#else
+#include "Mock/MockSpi.h"
+#endif
 #if defined(ARDUINO_ARCH_ESP32)
 #include "Esp32Spi.h"
 #endif
@@ -20,11 +26,16 @@ namespace Egfx
 	/// Platform SPI type. Required to access DMA functions.
 	/// </summary>
 	using SpiType = Esp32Spi;
-#else
+#elif defined(ARDUINO)
 	/// <summary>
 	/// Platform SPI type. Required to access DMA functions.
 	/// </summary>
 	using SpiType = SPIClass;
+#else
+	/// <summary>
+	/// Host mock SPI, for driver benchmarks and tests without hardware.
+	/// </summary>
+	using SpiType = MockSpi;
 #endif
 
 	// Selector for the screen communications hardware instance.
@@ -52,6 +63,15 @@ namespace Egfx
 	protected:
 		SpiType& SpiInstance;
 
+	private:
+		static constexpr uint8_t SEQUENCE_CHUNK_SIZE = 16;
+
+		const uint8_t* Sequence = nullptr;
+		SPISettings* SequenceSettings = nullptr;
+		uint32_t SequenceStart = 0;
+		uint32_t SequenceWait = 0;
+		uint8_t SequenceResetStage = 0;
+
 	public:
 		AbstractScreenDriverSPI(SpiType& spi)
 			: IScreenDriver()
@@ -63,6 +83,8 @@ namespace Egfx
 
 		virtual void BufferTaskCallback(void* parameter) {}
 		virtual void SetBufferTaskCallback(void (*taskCallback)(void* parameter)) {}
+		virtual bool SetPushCallback(void (*pushCallback)(void* parameter), void* parameter) { return false; }
+		virtual size_t GetPushedSize() { return 0; }
 
 		virtual bool Start()
 		{
@@ -78,25 +100,18 @@ namespace Egfx
 
 		virtual void Stop()
 		{
-			if (pinDC != UINT8_MAX)
-			{
-				digitalWrite(pinDC, LOW);
-			}
-
-			if (pinCS != UINT8_MAX)
-			{
-				digitalWrite(pinCS, HIGH);
-			}
-
-			if (pinRST != UINT8_MAX)
-			{
-				digitalWrite(pinRST, LOW);
-			}
+			Sequence = nullptr;
+			GpioPin<pinDC>::Low();
+			GpioPin<pinCS>::High();
+			GpioPin<pinRST>::Low();
 		}
 
+		/// <summary>
+		/// Steps the init sequence, if running. Push is only available once it has completed.
+		/// </summary>
 		virtual bool CanPushBuffer()
 		{
-			return true;
+			return InitSequenceStep();
 		}
 
 		virtual uint32_t PushBuffer(const uint8_t* frameBuffer)
@@ -127,24 +142,117 @@ namespace Egfx
 		}
 
 	protected:
-		void PinReset(const uint32_t waitPeriod = 10)
+		/// <summary>
+		/// Starts a non-blocking init sequence, stepped on every CanPushBuffer() call.
+		/// </summary>
+		/// <param name="sequence">InitSequence byte stream, in PROGMEM.</param>
+		/// <param name="settings">Driver SPI settings, with the driver's lifetime.</param>
+		void StartInitSequence(const uint8_t* sequence, SPISettings& settings)
 		{
-			pinMode(pinDC, OUTPUT);
-			digitalWrite(pinDC, LOW);
-			if (pinCS != UINT8_MAX)
+			Sequence = sequence;
+			SequenceSettings = &settings;
+			SequenceWait = 0;
+			SequenceResetStage = 0;
+		}
+
+		/// <summary>
+		/// Runs the init sequence up to the next wait.
+		/// Consecutive entries share a single transaction, data is sent in batched transfers.
+		/// </summary>
+		/// <returns>True when no sequence is running.</returns>
+		bool InitSequenceStep()
+		{
+			if (Sequence == nullptr)
 			{
-				digitalWrite(pinCS, HIGH);
-				pinMode(pinCS, OUTPUT);
+				return true;
 			}
 
-			if (pinRST != UINT8_MAX)
+			if (SequenceWait > 0)
 			{
-				digitalWrite(pinRST, HIGH);
-				pinMode(pinRST, OUTPUT);
+				if ((micros() - SequenceStart) < SequenceWait)
+				{
+					return false;
+				}
+				SequenceWait = 0;
+			}
+
+			bool transaction = false;
+			while (Sequence != nullptr && SequenceWait == 0)
+			{
+				const uint8_t header = InitSequence::Read(Sequence);
+				if (header <= InitSequence::MaxLength
+					|| (header >= InitSequence::Commands && header <= InitSequence::Commands + InitSequence::MaxCommands))
+				{
+					if (!transaction)
+					{
+						CommandStart(*SequenceSettings);
+						transaction = true;
+					}
+
+					if (header <= InitSequence::MaxLength)
+					{
+						SpiInstance.transfer(InitSequence::Read(&Sequence[1]));
+						GpioPin<pinDC>::High();
+						SequenceTransfer(&Sequence[2], header);
+						GpioPin<pinDC>::Low();
+						Sequence += 2 + header;
+					}
+					else
+					{
+						SequenceTransfer(&Sequence[1], header - InitSequence::Commands);
+						Sequence += 1 + header - InitSequence::Commands;
+					}
+				}
+				else
+				{
+					if (transaction)
+					{
+						CommandEnd();
+						transaction = false;
+					}
+
+					switch (header)
+					{
+					case InitSequence::Delay:
+						SequenceWait = InitSequence::PeriodMicros(InitSequence::Read(&Sequence[1]), InitSequence::Read(&Sequence[2]));
+						Sequence += 3;
+						break;
+					case InitSequence::Reset:
+						SequenceResetStep(InitSequence::PeriodMicros(InitSequence::Read(&Sequence[1]), InitSequence::Read(&Sequence[2])));
+						break;
+					case InitSequence::End:
+					default:
+						Sequence = nullptr;
+						break;
+					}
+
+					SequenceStart = micros();
+				}
+			}
+
+			if (transaction)
+			{
+				CommandEnd();
+			}
+
+			return Sequence == nullptr;
+		}
+
+		void PinReset(const uint32_t waitPeriod = 10)
+		{
+			GpioPin<pinDC>::Setup();
+			GpioPin<pinDC>::Low();
+			GpioPin<pinCS>::High();
+			GpioPin<pinCS>::Setup();
+
+			if (GpioPin<pinRST>::Enabled)
+			{
+				GpioPin<pinRST>::High();
+				GpioPin<pinRST>::Setup();
 				delayMicroseconds(waitPeriod);
-				digitalWrite(pinRST, LOW);
+				GpioPin<pinRST>::Low();
 				delayMicroseconds(waitPeriod);
-				digitalWrite(pinRST, HIGH);
+				GpioPin<pinRST>::High();
 			}
 		}
 
@@ -161,22 +269,75 @@ namespace Egfx
 
 		void CommandStart(SPISettings& settings)
 		{
-			if (pinCS != UINT8_MAX)
-			{
-				digitalWrite(pinCS, LOW);
-			}
-			digitalWrite(pinDC, LOW);
+			GpioPin<pinCS>::Low();
+			GpioPin<pinDC>::Low();
 			SpiInstance.beginTransaction(settings);
 		}
 
 		void CommandEnd()
 		{
 			SpiInstance.endTransaction();
-			if (pinCS != UINT8_MAX)
+			GpioPin<pinCS>::High();
+			GpioPin<pinDC>::Low();
+		}
+
+	private:
+		/// <summary>
+		/// Transfers sequence bytes through a RAM copy, as they may be in flash and the transfer may overwrite the buffer.
+		/// </summary>
+		void SequenceTransfer(const uint8_t* data, const uint8_t size)
+		{
+			uint8_t buffer[SEQUENCE_CHUNK_SIZE];
+
+			uint8_t offset = 0;
+			while (offset < size)
 			{
-				digitalWrite(pinCS, HIGH);
+				const uint8_t count = ((size - offset) > SEQUENCE_CHUNK_SIZE) ? SEQUENCE_CHUNK_SIZE : (size - offset);
+				for (uint8_t i = 0; i < count; i++)
+				{
+					buffer[i] = InitSequence::Read(&data[offset + i]);
+				}
+				SpiTransfer(buffer, count);
+				offset += count;
 			}
-			digitalWrite(pinDC, LOW);
+		}
+
+		/// <summary>
+		/// Hardware reset pulse, high-low-high, waiting the pulse period on each edge.
+		/// Only advances the sequence after the last edge.
+		/// </summary>
+		void SequenceResetStep(const uint32_t pulseMicros)
+		{
+			if (pulseMicros == 0 || !GpioPin<pinRST>::Enabled)
+			{
+				PinReset();
+				Sequence += 3;
+				return;
+			}
+
+			switch (SequenceResetStage)
+			{
+			case 0:
+				GpioPin<pinDC>::Setup();
+				GpioPin<pinDC>::Low();
+				GpioPin<pinCS>::High();
+				GpioPin<pinCS>::Setup();
+				GpioPin<pinRST>::High();
+				GpioPin<pinRST>::Setup();
+				SequenceResetStage = 1;
+				break;
+			case 1:
+				GpioPin<pinRST>::Low();
+				SequenceResetStage = 2;
+				break;
+			default:
+				GpioPin<pinRST>::High();
+				SequenceResetStage = 0;
+				Sequence += 3;
+				return;
+			}
+
+			SequenceWait = pulseMicros;
 		}
 	};
 }
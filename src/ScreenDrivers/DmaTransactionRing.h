@@ -0,0 +1,164 @@
+#ifndef _EGFX_DMA_TRANSACTION_RING_h
+#define _EGFX_DMA_TRANSACTION_RING_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace Egfx
+{
+	/// <summary>
+	/// Ring of in-flight DMA transactions, for chunked bulk writes.
+	/// Queues as many chunks as the depth allows up front and refills as completions are reaped.
+	/// Completions are expected in queue order (FIFO), so only the in-flight count is tracked.
+	///
+	/// Platform agnostic: queue calls go through a Backend, so the ring can run on host against a stand-in.
+	/// Backend requirements:
+	///	bool Queue(Transaction& transaction, const uint8_t* data, size_t length), non-blocking, false on failure.
+	///	bool Reap(), non-blocking, true if one completed transaction was collected.
+	/// </summary>
+	/// <typeparam name="Transaction">Platform transaction descriptor, owned by the ring while in flight.</typeparam>
+	/// <typeparam name="capacity">Maximum number of transactions in flight.</typeparam>
+	template<typename Transaction, uint8_t capacity>
+	class DmaTransactionRing
+	{
+	public:
+		static_assert(capacity > 0, "DmaTransactionRing capacity must be at least 1.");
+
+		static constexpr uint8_t Capacity = capacity;
+
+	private:
+		Transaction Slots[capacity]{};
+
+		const uint8_t* Pending = nullptr;
+		size_t PendingRemaining = 0;
+		size_t ChunkSize = 0;
+		size_t QueuedSize = 0;
+		size_t CompletedSize = 0;
+
+		uint8_t Depth = capacity;
+		uint8_t Head = 0;
+		uint8_t InFlight = 0;
+
+	public:
+		/// <summary>
+		/// Limits the number of transactions in flight. Clamped to [1, Capacity].
+		/// Only applies to the next Start().
+		/// </summary>
+		void SetDepth(const uint8_t depth)
+		{
+			if (!Busy())
+			{
+				Depth = (depth == 0) ? 1 : ((depth > capacity) ? capacity : depth);
+			}
+		}
+
+		uint8_t GetDepth() const
+		{
+			return Depth;
+		}
+
+		uint8_t GetInFlight() const
+		{
+			return InFlight;
+		}
+
+		/// <summary>
+		/// Bytes from the start of the current write whose transactions have been reaped.
+		/// </summary>
+		size_t GetCompletedSize() const
+		{
+			return CompletedSize;
+		}
+
+		/// <summary>
+		/// True while there are transactions in flight or data left to queue.
+		/// </summary>
+		bool Busy() const
+		{
+			return InFlight > 0 || PendingRemaining > 0;
+		}
+
+		/// <summary>
+		/// Starts a new bulk write, queuing up to Depth chunks.
+		/// </summary>
+		/// <param name="data">Source buffer, must remain valid until not Busy().</param>
+		/// <param name="length">Total bytes.</param>
+		/// <param name="chunkSize">Maximum bytes per transaction.</param>
+		/// <returns>True if at least one chunk was queued.</returns>
+		template<typename Backend>
+		bool Start(Backend& backend, const uint8_t* data, const size_t length, const size_t chunkSize)
+		{
+			if (Busy() || data == nullptr || length == 0 || chunkSize == 0)
+			{
+				return false;
+			}
+
+			Pending = data;
+			PendingRemaining = length;
+			ChunkSize = chunkSize;
+			QueuedSize = 0;
+			CompletedSize = 0;
+
+			Fill(backend);
+
+			return InFlight > 0;
+		}
+
+		/// <summary>
+		/// Reaps all completed transactions and refills the freed slots.
+		/// </summary>
+		/// <returns>Busy().</returns>
+		template<typename Backend>
+		bool Service(Backend& backend)
+		{
+			while (InFlight > 0 && backend.Reap())
+			{
+				InFlight--;
+
+				// In order completion: only the last queued chunk may be short.
+				CompletedSize = (QueuedSize - CompletedSize > ChunkSize) ? CompletedSize + ChunkSize : QueuedSize;
+			}
+
+			Fill(backend);
+
+			return Busy();
+		}
+
+		/// <summary>
+		/// Forgets all state. The caller is responsible for draining the platform queue.
+		/// </summary>
+		void Clear()
+		{
+			Pending = nullptr;
+			PendingRemaining = 0;
+			QueuedSize = 0;
+			CompletedSize = 0;
+			Head = 0;
+			InFlight = 0;
+		}
+
+	private:
+		template<typename Backend>
+		void Fill(Backend& backend)
+		{
+			while (InFlight < Depth && PendingRemaining > 0)
+			{
+				const size_t chunk = (PendingRemaining > ChunkSize) ? ChunkSize : PendingRemaining;
+
+				if (!backend.Queue(Slots[Head], Pending, chunk))
+				{
+					// Abort the remaining data, in-flight transactions still drain.
+					PendingRemaining = 0;
+					return;
+				}
+
+				Pending += chunk;
+				PendingRemaining -= chunk;
+				QueuedSize += chunk;
+				Head = (Head + 1 >= capacity) ? 0 : Head + 1;
+				InFlight++;
+			}
+		}
+	};
+}
+#endif
\ No newline at end of file
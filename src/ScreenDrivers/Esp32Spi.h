@@ -7,6 +7,8 @@
 #include <SPI.h>
 #include <driver/spi_master.h>
 
+#include "DmaTransactionRing.h"
+
 namespace Egfx
 {
 	/// <summary>
@@ -18,7 +20,11 @@ namespace Egfx
 	/// - Store pin/host configuration so presets or templates can configure the bus once and reuse it.
 	/// 
 	/// Notes:
-	/// - The DMA path uses ESP-IDF `spi_device_queue_trans()` and requires polling via `DmaBusy()`.
+	/// - The DMA path uses ESP-IDF `spi_device_queue_trans()` and is driven by calling `DmaBusy()`.
+	///   Chunks of `MaxTransferBytes` are queued up front, up to the configured queue depth,
+	///   so a whole frame can be queued at once when depth * `MaxTransferBytes` covers it.
+	///   An optional transfer callback is raised from the transaction post-callback (ISR) on every completed chunk,
+	///   so callers only need to call `DmaBusy()` when signalled.
 	/// - This class does not attempt to synchronize Arduino transactions with IDF transactions. In EGFX,
 	///   commands typically use the inline driver (`SPIClass`), while framebuffer bulk data may use DMA.
 	/// </summary>
@@ -50,19 +56,43 @@ namespace Egfx
 		// IDF device handle used for queued DMA transactions.
 		spi_device_handle_t Device = nullptr;
 
-		// Async transfer state tracking.
-		bool AsyncInFlight = false;
+	public:
+		// Maximum queued/in-flight transactions.
+		static constexpr uint8_t DmaQueueCapacity = 16;
+
+	private:
+		/// <summary>
+		/// IDF spi_master queue calls for the transaction ring.
+		/// </summary>
+		struct IdfQueue
+		{
+			spi_device_handle_t Device;
+			void* User;
+
+			bool Queue(spi_transaction_t& transaction, const uint8_t* data, const size_t length)
+			{
+				memset(&transaction, 0, sizeof(transaction));
+				transaction.tx_buffer = data;
+				transaction.length = length * 8;
+				transaction.user = User;
+
+				return spi_device_queue_trans(Device, &transaction, 0) == ESP_OK;
+			}
+
+			bool Reap()
+			{
+				spi_transaction_t* done = nullptr;
+
+				return spi_device_get_trans_result(Device, &done, 0) == ESP_OK && done != nullptr;
+			}
+		};
 
-		// Two transaction slots; the driver can have up to 2 queued/in-flight transactions.
-		spi_transaction_t TransA{};
-		spi_transaction_t TransB{};
-		bool TransAInUse = false;
-		bool TransBInUse = false;
+		// Transaction ring, over the caller-provided buffer. EGFX guarantees it remains valid until push ends.
+		DmaTransactionRing<spi_transaction_t, DmaQueueCapacity> Ring{};
 
-		// Pointer to the caller-provided buffer. EGFX guarantees it remains valid until push ends.
-		const uint8_t* Pending = nullptr;
-		size_t PendingOffset = 0;
-		size_t PendingRemaining = 0;
+		// Optional completion notification, called from ISR context.
+		void (*TransferCallback)(void* parameter) = nullptr;
+		void* TransferParameter = nullptr;
 
 	public:
 		/// <param name="arduinoBusId">Arduino bus id (typically `VSPI` or `HSPI`).</param>
@@ -101,6 +131,28 @@ namespace Egfx
 			MaxTransferBytes = maxBytes;
 		}
 
+		/// <summary>
+		/// Sets the number of DMA transactions queued ahead, up to `DmaQueueCapacity`.
+		/// Must be called before `DmaBegin()`, as it sizes the IDF device queue.
+		/// </summary>
+		void ConfigureQueueDepth(uint8_t depth)
+		{
+			if (!DmaReady)
+			{
+				Ring.SetDepth(depth);
+			}
+		}
+
+		/// <summary>
+		/// Sets the callback raised (from ISR context) whenever a queued DMA chunk completes.
+		/// The callback must be IRAM safe and should only set a flag; progress is still driven by `DmaBusy()`.
+		/// </summary>
+		void SetTransferCallback(void (*transferCallback)(void* parameter), void* parameter)
+		{
+			TransferParameter = parameter;
+			TransferCallback = transferCallback;
+		}
+
 		/// <summary>
 		/// Starts Arduino SPIClass using configured pins (if provided).
 		/// This should be called before inline driver initialization sequences that use `SPIClass`.
@@ -193,7 +245,7 @@ namespace Egfx
 			spi_device_interface_config_t devcfg{};
 			devcfg.clock_speed_hz = (int)DmaClockHz;
 			devcfg.mode = DmaMode;
-			devcfg.queue_size = 2;
+			devcfg.queue_size = Ring.GetDepth();
 			devcfg.flags = SPI_DEVICE_NO_DUMMY;
 
 			// Hardware CS if requested; otherwise caller toggles CS (common for EGFX drivers).
@@ -203,6 +255,9 @@ namespace Egfx
 			devcfg.cs_ena_pretrans = 1;
 			devcfg.cs_ena_posttrans = 1;
 
+			// Completion notification, transactions carry this instance in their user field.
+			devcfg.post_cb = OnTransactionDone;
+
 			const esp_err_t devOk = spi_bus_add_device(Host, &devcfg, &Device);
 			if (devOk != ESP_OK)
 				return false;
@@ -216,135 +271,76 @@ namespace Egfx
 		/// </summary>
 		void DmaEnd()
 		{
-			AsyncInFlight = false;
-			TransAInUse = false;
-			TransBInUse = false;
-
 			if (Device != nullptr)
 			{
-				// Drain any pending results (non-blocking).
+				// Drain in-flight transactions before the device is removed.
 				spi_transaction_t* done = nullptr;
-				while (spi_device_get_trans_result(Device, &done, 0) == ESP_OK && done != nullptr) {}
+				for (uint8_t i = Ring.GetInFlight(); i > 0; i--)
+				{
+					spi_device_get_trans_result(Device, &done, portMAX_DELAY);
+				}
 
 				spi_bus_remove_device(Device);
 				Device = nullptr;
 			}
+			Ring.Clear();
 
 			DmaReady = false;
 		}
 
 		/// <summary>
-		/// Begins an async DMA write. This queues the first chunk and returns immediately.
-		/// Completion/progress is driven by calling `DmaBusy()` repeatedly.
+		/// Begins an async DMA write. This queues up to the configured depth of chunks and returns immediately.
+		/// Completion/progress is driven by calling `DmaBusy()` repeatedly (or when signalled).
 		/// </summary>
 		/// <param name="data">Pointer to the source buffer (must remain valid until NOT busy).</param>
 		/// <param name="lenBytes">Total bytes to transmit.</param>
 		/// <returns>True if queued successfully, false otherwise.</returns>
 		bool DmaWriteAsync(const void* data, size_t lenBytes)
 		{
-			if (!DmaReady || Device == nullptr || data == nullptr || lenBytes == 0)
+			if (!DmaReady || Device == nullptr)
 				return false;
-			if (AsyncInFlight)
-				return false;
-
-			Pending = static_cast<const uint8_t*>(data);
-			PendingOffset = 0;
-			PendingRemaining = lenBytes;
-
-			// Clear transaction structs and in-use flags for a new sequence.
-			memset(&TransA, 0, sizeof(TransA));
-			memset(&TransB, 0, sizeof(TransB));
-			TransAInUse = false;
-			TransBInUse = false;
 
-			AsyncInFlight = true;
+			IdfQueue queue{ Device, this };
 
-			// Queue the first transaction (kick-off).
-			QueueOne();
-			return true;
+			return Ring.Start(queue, static_cast<const uint8_t*>(data), lenBytes, MaxTransferBytes);
 		}
 
 		/// <summary>
-		/// Polls the async DMA transfer state.
+		/// Polls the async DMA transfer state, reaping completed chunks and refilling the queue.
 		/// Returns true while there is still outstanding work (queued/in-flight).
+		/// A queue failure aborts the remaining data.
 		/// </summary>
 		bool DmaBusy()
 		{
-			if (!AsyncInFlight)
+			if (!Ring.Busy())
 				return false;
 
-			// Attempt to reap at most one finished transaction (non-blocking).
-			ReapCompleted();
-
-			// If we have no data left and nothing in flight, we're done.
-			if (PendingRemaining == 0 && !TransAInUse && !TransBInUse)
-			{
-				AsyncInFlight = false;
-				return false;
-			}
+			IdfQueue queue{ Device, this };
 
-			// Keep feeding one chunk per poll (bounded work model).
-			QueueOne();
-			return true;
+			return Ring.Service(queue);
 		}
 
-	private:
 		/// <summary>
-		/// Reaps at most one completed transaction from the IDF queue (non-blocking).
-		/// This function is intentionally non-greedy: caller is expected to poll frequently.
+		/// Bytes of the current async write already transmitted, from the start.
+		/// Updated by `DmaBusy()`.
 		/// </summary>
-		void ReapCompleted()
+		size_t DmaCompletedSize() const
 		{
-			spi_transaction_t* done = nullptr;
-			const esp_err_t r = spi_device_get_trans_result(Device, &done, 0);
-
-			if (r == ESP_OK && done != nullptr)
-			{
-				if (done == &TransA) TransAInUse = false;
-				if (done == &TransB) TransBInUse = false;
-			}
+			return Ring.GetCompletedSize();
 		}
 
+	private:
 		/// <summary>
-		/// Queues a single chunk if a transaction slot is available.
-		/// Chunk size is limited by `MaxTransferBytes`.
+		/// IDF post-transaction callback, runs in ISR context.
 		/// </summary>
-		void QueueOne()
+		static void IRAM_ATTR OnTransactionDone(spi_transaction_t* transaction)
 		{
-			if (PendingRemaining == 0)
-				return;
-
-			spi_transaction_t* t = nullptr;
+			Esp32Spi* self = static_cast<Esp32Spi*>(transaction->user);
 
-			if (!TransAInUse) t = &TransA;
-			else if (!TransBInUse) t = &TransB;
-			else return;
-
-			const size_t chunk = (PendingRemaining > MaxTransferBytes)
-				? MaxTransferBytes
-				: PendingRemaining;
-
-			// Reset the transaction fields for this queued chunk.
-			memset(t, 0, sizeof(*t));
-			t->tx_buffer = Pending + PendingOffset;
-			t->length = chunk * 8;
-
-			const esp_err_t q = spi_device_queue_trans(Device, t, 0);
-			if (q != ESP_OK)
+			if (self != nullptr && self->TransferCallback != nullptr)
 			{
-				// Abort async sequence on queue failure.
-				AsyncInFlight = false;
-				PendingRemaining = 0;
-				TransAInUse = false;
-				TransBInUse = false;
-				return;
+				self->TransferCallback(self->TransferParameter);
 			}
-
-			if (t == &TransA) TransAInUse = true;
-			if (t == &TransB) TransBInUse = true;
-
-			PendingOffset += chunk;
-			PendingRemaining -= chunk;
 		}
 	};
 }
@@ -2,6 +2,7 @@
 #define _EGFX_SCREEN_DRIVERS_GC9A01_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace GC9A01
 {
@@ -61,108 +62,78 @@ namespace GC9A01
 
 	namespace Init
 	{
-		struct RawCommand final
-		{
-			uint8_t Command;
-			const uint8_t* Data;
-			size_t Length;
-		};
+		namespace InitSequence = Egfx::InitSequence;
 
-		static constexpr RawCommand Cmd(const uint8_t command)
-		{
-			return { command, nullptr, 0 };
-		}
-
-		static constexpr RawCommand Cmd(const uint8_t command, const uint8_t* data, const size_t length)
-		{
-			return { command, data, length };
-		}
-
-		// Payload bytes
-		static constexpr uint8_t EB_14[]{ 0x14 };
-		static constexpr uint8_t C_40[]{ 0x40 };
-		static constexpr uint8_t C_FF[]{ 0xFF };
-		static constexpr uint8_t C_0A[]{ 0x0A };
-		static constexpr uint8_t C_21[]{ 0x21 };
-		static constexpr uint8_t C_00[]{ 0x00 };
-		static constexpr uint8_t C_80[]{ 0x80 };
-		static constexpr uint8_t C_01[]{ 0x01 };
-		static constexpr uint8_t B6[]{ 0x00, 0x20 };
-		static constexpr uint8_t C90[]{ 0x08, 0x08, 0x08, 0x08 };
-		static constexpr uint8_t BD[]{ 0x06 };
-		static constexpr uint8_t BC[]{ 0x00 };
-		static constexpr uint8_t FF[]{ 0x60, 0x01, 0x04 };
-		static constexpr uint8_t C_13[]{ 0x13 };
-		static constexpr uint8_t C_22[]{ 0x22 };
-		static constexpr uint8_t C_11[]{ 0x11 };
-		static constexpr uint8_t E1[]{ 0x10, 0x0E };
-		static constexpr uint8_t DF[]{ 0x21, 0x0C, 0x02 };
-		static constexpr uint8_t F0[]{ 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A };
-		static constexpr uint8_t F1[]{ 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F };
-		static constexpr uint8_t ED[]{ 0x1B, 0x0B };
-		static constexpr uint8_t AE[]{ 0x77 };
-		static constexpr uint8_t CD[]{ 0x63 };
-		static constexpr uint8_t C70[]{ 0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08, 0x03 };
-		static constexpr uint8_t E8[]{ 0x34 };
-		static constexpr uint8_t C62[]{ 0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70 };
-		static constexpr uint8_t C63[]{ 0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70 };
-		static constexpr uint8_t C64[]{ 0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07 };
-		static constexpr uint8_t C66[]{ 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00 };
-		static constexpr uint8_t C67[]{ 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98 };
-		static constexpr uint8_t C74[]{ 0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00 };
-		static constexpr uint8_t C98[]{ 0x3E, 0x07 };
-
-		// Used by the driver. This is the vendor init block.
-		static constexpr RawCommand Sequence[] =
+		// Full controller init, including the vendor init block.
+		static constexpr uint8_t Sequence[] PROGMEM
 		{
-			Cmd(0xEF),
-			Cmd(0xEB, EB_14, sizeof(EB_14)),
-			Cmd(0xFE),
-			Cmd(0xEF),
-			Cmd(0xEB, EB_14, sizeof(EB_14)),
-
-			Cmd(0x84, C_40, sizeof(C_40)),
-			Cmd(0x85, C_FF, sizeof(C_FF)),
-			Cmd(0x86, C_FF, sizeof(C_FF)),
-			Cmd(0x87, C_FF, sizeof(C_FF)),
-			Cmd(0x88, C_0A, sizeof(C_0A)),
-			Cmd(0x89, C_21, sizeof(C_21)),
-			Cmd(0x8A, C_00, sizeof(C_00)),
-			Cmd(0x8B, C_80, sizeof(C_80)),
-			Cmd(0x8C, C_01, sizeof(C_01)),
-			Cmd(0x8D, C_01, sizeof(C_01)),
-			Cmd(0x8E, C_FF, sizeof(C_FF)),
-			Cmd(0x8F, C_FF, sizeof(C_FF)),
-
-			Cmd(0xB6, B6, sizeof(B6)),
-			Cmd(0x90, C90, sizeof(C90)),
-			Cmd(0xBD, BD, sizeof(BD)),
-			Cmd(0xBC, BC, sizeof(BC)),
-			Cmd(0xFF, FF, sizeof(FF)),
-			Cmd(0xC3, C_13, sizeof(C_13)),
-			Cmd(0xC4, C_13, sizeof(C_13)),
-			Cmd(0xC9, C_22, sizeof(C_22)),
-			Cmd(0xBE, C_11, sizeof(C_11)),
-			Cmd(0xE1, E1, sizeof(E1)),
-			Cmd(0xDF, DF, sizeof(DF)),
-
-			Cmd(0xF0, F0, sizeof(F0)),
-			Cmd(0xF1, F1, sizeof(F1)),
-			Cmd(0xF2, F0, sizeof(F0)),
-			Cmd(0xF3, F1, sizeof(F1)),
-
-			Cmd(0xED, ED, sizeof(ED)),
-			Cmd(0xAE, AE, sizeof(AE)),
-			Cmd(0xCD, CD, sizeof(CD)),
-			Cmd(0x70, C70, sizeof(C70)),
-			Cmd(0xE8, E8, sizeof(E8)),
-			Cmd(0x62, C62, sizeof(C62)),
-			Cmd(0x63, C63, sizeof(C63)),
-			Cmd(0x64, C64, sizeof(C64)),
-			Cmd(0x66, C66, sizeof(C66)),
-			Cmd(0x67, C67, sizeof(C67)),
-			Cmd(0x74, C74, sizeof(C74)),
-			Cmd(0x98, C98, sizeof(C98)),
+			InitSequence::Reset, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+			0, (uint8_t)CommandEnum::SoftwareReset,
+			InitSequence::Delay, InitSequence::PeriodHigh(20000), InitSequence::PeriodLow(20000),
+			0, (uint8_t)CommandEnum::SleepOut,
+			InitSequence::Delay, InitSequence::PeriodHigh(SLEEP_EXIT_DELAY_MICROS), InitSequence::PeriodLow(SLEEP_EXIT_DELAY_MICROS),
+
+			// Vendor init block.
+			0, 0xEF,
+			1, 0xEB, 0x14,
+			0, 0xFE,
+			0, 0xEF,
+			1, 0xEB, 0x14,
+
+			1, 0x84, 0x40,
+			1, 0x85, 0xFF,
+			1, 0x86, 0xFF,
+			1, 0x87, 0xFF,
+			1, 0x88, 0x0A,
+			1, 0x89, 0x21,
+			1, 0x8A, 0x00,
+			1, 0x8B, 0x80,
+			1, 0x8C, 0x01,
+			1, 0x8D, 0x01,
+			1, 0x8E, 0xFF,
+			1, 0x8F, 0xFF,
+
+			2, 0xB6, 0x00, 0x20,
+			4, 0x90, 0x08, 0x08, 0x08, 0x08,
+			1, 0xBD, 0x06,
+			1, 0xBC, 0x00,
+			3, 0xFF, 0x60, 0x01, 0x04,
+			1, 0xC3, 0x13,
+			1, 0xC4, 0x13,
+			1, 0xC9, 0x22,
+			1, 0xBE, 0x11,
+			2, 0xE1, 0x10, 0x0E,
+			3, 0xDF, 0x21, 0x0C, 0x02,
+
+			6, 0xF0, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+			6, 0xF1, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+			6, 0xF2, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+			6, 0xF3, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+
+			2, 0xED, 0x1B, 0x0B,
+			1, 0xAE, 0x77,
+			1, 0xCD, 0x63,
+			9, 0x70, 0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08, 0x03,
+			1, 0xE8, 0x34,
+			12, 0x62, 0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70,
+			12, 0x63, 0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70,
+			7, 0x64, 0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07,
+			10, 0x66, 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00,
+			10, 0x67, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98,
+			7, 0x74, 0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00,
+			2, 0x98, 0x3E, 0x07,
+
+			1, (uint8_t)CommandEnum::MemoryAccessCtrl, 0x08,
+			1, (uint8_t)CommandEnum::PixelFormatSet, PixelFormats::Rgb565,
+			4, (uint8_t)CommandEnum::ColumnAddressSet, 0, 0, InitSequence::High(Width - 1), InitSequence::Low(Width - 1),
+			4, (uint8_t)CommandEnum::RowAddressSet, 0, 0, InitSequence::High(Height - 1), InitSequence::Low(Height - 1),
+			InitSequence::Commands + 2,
+			(uint8_t)CommandEnum::DisplayInversionOn,
+			(uint8_t)CommandEnum::NormalDisplayOn,
+			InitSequence::Delay, InitSequence::PeriodHigh(DISPLAY_ON_DELAY_MICROS), InitSequence::PeriodLow(DISPLAY_ON_DELAY_MICROS),
+			0, (uint8_t)CommandEnum::DisplayOn,
+			InitSequence::Delay, InitSequence::PeriodHigh(DISPLAY_ON_DELAY_MICROS), InitSequence::PeriodLow(DISPLAY_ON_DELAY_MICROS),
+			InitSequence::End
 		};
 	}
 }
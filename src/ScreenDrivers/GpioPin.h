@@ -0,0 +1,195 @@
+#ifndef _EGFX_GPIO_PIN_h
+#define _EGFX_GPIO_PIN_h
+
+#include "../Platform/Platform.h"
+
+// The mbed RP2040 core numbers pins by board, not by GPIO.
+#if defined(ARDUINO_ARCH_MBED_RP2040) || (defined(ARDUINO_ARCH_RP2040) && defined(ARDUINO_ARCH_MBED))
+#define EGFX_GPIO_PIN_MBED_RP2040
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(EGFX_GPIO_PIN_MBED_RP2040)
+#include "hardware/structs/sio.h"
+#elif defined(ARDUINO_ARCH_ESP32)
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+#endif
+
+namespace Egfx
+{
+#if !defined(ARDUINO)
+	/// <summary>
+	/// Host mock GPIO log, records every pin write for inspection.
+	/// </summary>
+	struct MockGpioLog
+	{
+		struct Entry
+		{
+			uint8_t Pin;
+			bool Level;
+		};
+
+		static constexpr size_t Capacity = 512;
+
+		Entry Entries[Capacity]{};
+		size_t Count = 0;
+		uint32_t Writes = 0;
+		uint8_t Levels[UINT8_MAX]{};
+
+		void Clear()
+		{
+			Count = 0;
+			Writes = 0;
+		}
+
+		void Record(const uint8_t pin, const bool level)
+		{
+			if (Count < Capacity)
+			{
+				Entries[Count++] = { pin, level };
+			}
+			Levels[pin] = level;
+			Writes++;
+		}
+
+		static MockGpioLog& Instance()
+		{
+			static MockGpioLog log{};
+
+			return log;
+		}
+	};
+#endif
+
+	/// <summary>
+	/// Compile-time output pin, with direct register set/clear where the platform allows.
+	/// Used for DC/CS/RST toggling in screen driver hot paths.
+	/// Falls back to digitalWrite() on unknown Arduino platforms and records writes on host builds.
+	/// Where the pin to register mapping is a runtime lookup, it is done once on static initialization,
+	/// so pins must not be toggled from other static constructors.
+	/// </summary>
+	/// <typeparam name="pin">Arduino pin number.</typeparam>
+	template<uint8_t pin>
+	struct GpioPin
+	{
+		static constexpr bool Enabled = true;
+
+	private:
+#if defined(EGFX_GPIO_PIN_MBED_RP2040)
+		// Arduino pin numbers are not GPIO numbers on the mbed core.
+		static const uint32_t Mask;
+#elif defined(ARDUINO_ARCH_AVR)
+		// Port and bit mask tables are in flash, read them once.
+		static volatile uint8_t* const Port;
+		static const uint8_t Mask;
+#endif
+
+	public:
+		static void Setup()
+		{
+#if defined(ARDUINO)
+			pinMode(pin, OUTPUT);
+#endif
+		}
+
+		static void High()
+		{
+#if defined(EGFX_GPIO_PIN_MBED_RP2040)
+			sio_hw->gpio_set = Mask;
+#elif defined(ARDUINO_ARCH_RP2040)
+			sio_hw->gpio_set = uint32_t(1) << pin;
+#elif defined(ARDUINO_ARCH_ESP32)
+#if defined(GPIO_OUT1_W1TS_REG)
+			if (pin >= 32)
+			{
+				REG_WRITE(GPIO_OUT1_W1TS_REG, uint32_t(1) << (pin & 31));
+			}
+			else
+#endif
+			{
+				REG_WRITE(GPIO_OUT_W1TS_REG, uint32_t(1) << (pin & 31));
+			}
+#elif defined(ARDUINO_ARCH_STM32)
+			digitalWriteFast(digitalPinToPinName(pin), HIGH);
+#elif defined(ARDUINO_ARCH_AVR)
+			const uint8_t oldSreg = SREG;
+			cli();
+			*Port |= Mask;
+			SREG = oldSreg;
+#elif defined(ARDUINO)
+			digitalWrite(pin, HIGH);
+#else
+			MockGpioLog::Instance().Record(pin, true);
+#endif
+		}
+
+		static void Low()
+		{
+#if defined(EGFX_GPIO_PIN_MBED_RP2040)
+			sio_hw->gpio_clr = Mask;
+#elif defined(ARDUINO_ARCH_RP2040)
+			sio_hw->gpio_clr = uint32_t(1) << pin;
+#elif defined(ARDUINO_ARCH_ESP32)
+#if defined(GPIO_OUT1_W1TC_REG)
+			if (pin >= 32)
+			{
+				REG_WRITE(GPIO_OUT1_W1TC_REG, uint32_t(1) << (pin & 31));
+			}
+			else
+#endif
+			{
+				REG_WRITE(GPIO_OUT_W1TC_REG, uint32_t(1) << (pin & 31));
+			}
+#elif defined(ARDUINO_ARCH_STM32)
+			digitalWriteFast(digitalPinToPinName(pin), LOW);
+#elif defined(ARDUINO_ARCH_AVR)
+			const uint8_t oldSreg = SREG;
+			cli();
+			*Port &= ~Mask;
+			SREG = oldSreg;
+#elif defined(ARDUINO)
+			digitalWrite(pin, LOW);
+#else
+			MockGpioLog::Instance().Record(pin, false);
+#endif
+		}
+
+		static void Write(const bool level)
+		{
+			if (level)
+			{
+				High();
+			}
+			else
+			{
+				Low();
+			}
+		}
+	};
+
+#if defined(EGFX_GPIO_PIN_MBED_RP2040)
+	template<uint8_t pin>
+	const uint32_t GpioPin<pin>::Mask = uint32_t(1) << static_cast<uint8_t>(digitalPinToPinName(pin));
+#elif defined(ARDUINO_ARCH_AVR)
+	template<uint8_t pin>
+	volatile uint8_t* const GpioPin<pin>::Port = portOutputRegister(digitalPinToPort(pin));
+
+	template<uint8_t pin>
+	const uint8_t GpioPin<pin>::Mask = digitalPinToBitMask(pin);
+#endif
+
+	/// <summary>
+	/// Unused pin (UINT8_MAX), all operations compile out.
+	/// </summary>
+	template<>
+	struct GpioPin<UINT8_MAX>
+	{
+		static constexpr bool Enabled = false;
+
+		static void Setup() {}
+		static void High() {}
+		static void Low() {}
+		static void Write(const bool) {}
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#ifndef _EGFX_INIT_SEQUENCE_h
+#define _EGFX_INIT_SEQUENCE_h
+
+#include <stdint.h>
+
+// Host memory is flat, flash tables live in RAM.
+#if !defined(ARDUINO) && !defined(PROGMEM)
+#define PROGMEM
+#endif
+
+namespace Egfx
+{
+	/// <summary>
+	/// Compact controller initialization sequence, as a constexpr byte stream.
+	/// Each entry starts with a header byte:
+	///	0 to MaxLength: { length, command, data[length] }, command with data.
+	///	Commands + n: { Commands + n, command[n] }, n data-less commands.
+	///	Delay: { Delay, PeriodHigh, PeriodLow }, non-blocking wait.
+	///	Reset: { Reset, PeriodHigh, PeriodLow }, hardware reset pulse on the RST pin. 0 for a minimal (blocking) pulse.
+	///	End: end of the sequence.
+	/// Periods are exact microseconds up to MaxMicros, milliseconds (rounded up) above.
+	/// Waits are non-blocking, so they last at least the period, up to the caller's polling interval.
+	/// Sequences are stored in PROGMEM and executed by the abstract SPI and I2C drivers, which yield on every wait.
+	/// On I2C, each command entry is one command mode transmission and Reset only waits, as there is no reset pin.
+	/// </summary>
+	namespace InitSequence
+	{
+		static constexpr uint8_t MaxLength = 0x7F;
+
+		static constexpr uint8_t Commands = 0x80;
+		static constexpr uint8_t MaxCommands = 0x3F;
+
+		static constexpr uint8_t Delay = 0xFD;
+		static constexpr uint8_t Reset = 0xFE;
+		static constexpr uint8_t End = 0xFF;
+
+		static constexpr uint16_t MaxMicros = 0x7FFF;
+		static constexpr uint16_t PeriodMillisFlag = 0x8000;
+
+		/// <summary>
+		/// Encodes a microsecond period as 15 bits of microseconds or, above MaxMicros, of milliseconds.
+		/// </summary>
+		static constexpr uint16_t Period(const uint32_t micros)
+		{
+			return micros <= MaxMicros ? uint16_t(micros)
+				: (((micros + 999) / 1000) > MaxMicros ? uint16_t(PeriodMillisFlag | MaxMicros)
+					: uint16_t(PeriodMillisFlag | ((micros + 999) / 1000)));
+		}
+
+		static constexpr uint8_t PeriodHigh(const uint32_t micros)
+		{
+			return uint8_t(Period(micros) >> 8);
+		}
+
+		static constexpr uint8_t PeriodLow(const uint32_t micros)
+		{
+			return uint8_t(Period(micros) & UINT8_MAX);
+		}
+
+		/// <summary>
+		/// Decodes an encoded period back to microseconds.
+		/// </summary>
+		static constexpr uint32_t PeriodMicros(const uint8_t high, const uint8_t low)
+		{
+			return (high & (PeriodMillisFlag >> 8)) ? (uint32_t(((uint16_t(high) << 8) | low) & MaxMicros) * 1000)
+				: ((uint16_t(high) << 8) | low);
+		}
+
+		/// <summary>
+		/// Reads a sequence byte from flash/PROGMEM on AVR, from memory on other targets.
+		/// </summary>
+		static uint8_t Read(const uint8_t* sequence)
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			return pgm_read_byte(sequence);
+#else
+			return *sequence;
+#endif
+		}
+
+		static constexpr uint8_t High(const uint16_t value)
+		{
+			return uint8_t(value >> 8);
+		}
+
+		static constexpr uint8_t Low(const uint16_t value)
+		{
+			return uint8_t(value & UINT8_MAX);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,215 @@
+/// <summary>
+/// Host test of DmaTransactionRing against MockDmaQueue, the IDF spi_master queue stand-in.
+/// Only built on host with EGFX_MOCK_TESTS defined, e.g.:
+///	g++ -std=c++11 -DEGFX_MOCK_TESTS -I src src/ScreenDrivers/Mock/DmaTransactionRingTest.cpp -o DmaTransactionRingTest
+/// Returns the number of failed checks.
+/// </summary>
+#if !defined(ARDUINO) && defined(EGFX_MOCK_TESTS)
+#include <stdio.h>
+#include <vector>
+#include "MockDmaQueue.h"
+#include "../DmaTransactionRing.h"
+
+namespace
+{
+	using namespace Egfx;
+
+	uint32_t Failures = 0;
+
+	void Check(const bool condition, const char* test, const char* what)
+	{
+		if (!condition)
+		{
+			Failures++;
+			printf("FAIL %s: %s\n", test, what);
+		}
+	}
+
+	struct Capture : IMockBusListener
+	{
+		std::vector<uint8_t> Bytes;
+
+		void OnBusByte(const uint8_t value, const bool) override
+		{
+			Bytes.push_back(value);
+		}
+	};
+
+	std::vector<uint8_t> MakeSource(const size_t length)
+	{
+		std::vector<uint8_t> source(length);
+		for (size_t i = 0; i < length; i++)
+		{
+			source[i] = uint8_t((i * 7) + (i >> 8));
+		}
+
+		return source;
+	}
+
+	/// <summary>
+	/// Completes one transaction at a time, servicing the ring after each,
+	/// and checks the in-flight depth and the completed size along the way.
+	/// </summary>
+	template<uint8_t capacity, uint8_t queueSize>
+	void StepThrough(const char* test, const uint8_t depth, const size_t length, const size_t chunkSize)
+	{
+		MockDmaQueue<queueSize> queue{};
+		typename MockDmaQueue<queueSize>::Backend backend{ queue };
+		DmaTransactionRing<MockDmaTransaction, capacity> ring{};
+		Capture capture{};
+		queue.SetListener(&capture);
+
+		const std::vector<uint8_t> source = MakeSource(length);
+		const uint8_t expectedDepth = (depth == 0) ? 1 : ((depth > capacity) ? capacity : depth);
+		const size_t chunks = (length + chunkSize - 1) / chunkSize;
+
+		ring.SetDepth(depth);
+		Check(ring.GetDepth() == expectedDepth, test, "depth clamped to [1, capacity]");
+		Check(ring.Start(backend, source.data(), length, chunkSize), test, "start queues");
+		Check(ring.GetInFlight() == ((chunks < expectedDepth) ? chunks : expectedDepth), test, "start fills up to depth");
+
+		ring.SetDepth(capacity);
+		Check(ring.GetDepth() == expectedDepth, test, "depth fixed while busy");
+
+		size_t done = 0;
+		while (ring.Busy())
+		{
+			if (queue.Complete(1) == 0)
+			{
+				Check(false, test, "busy with nothing pending");
+				break;
+			}
+			done++;
+
+			ring.Service(backend);
+
+			const size_t completed = (done * chunkSize < length) ? done * chunkSize : length;
+			Check(ring.GetCompletedSize() == completed, test, "completed size follows reaped chunks");
+			Check(ring.GetInFlight() <= expectedDepth, test, "in flight within depth");
+		}
+
+		Check(done == chunks, test, "one transaction per chunk");
+		Check(queue.MaxQueued == ((chunks < expectedDepth) ? chunks : expectedDepth), test, "queue depth reached");
+		Check(queue.ReuseErrors == 0, test, "no descriptor reused in flight");
+		Check(capture.Bytes == source, test, "bytes in order");
+		Check(queue.GetPending() == 0 && queue.GetDone() == 0, test, "queue drained");
+	}
+
+	/// <summary>
+	/// Completions reaped in bursts, more than one per service and none on some.
+	/// </summary>
+	void Bursts()
+	{
+		const char* test = "bursts";
+		MockDmaQueue<8> queue{};
+		MockDmaQueue<8>::Backend backend{ queue };
+		DmaTransactionRing<MockDmaTransaction, 8> ring{};
+		Capture capture{};
+		queue.SetListener(&capture);
+
+		const std::vector<uint8_t> source = MakeSource(1000);
+		ring.SetDepth(3);
+		ring.Start(backend, source.data(), source.size(), 64);
+
+		Check(ring.Service(backend) && ring.GetCompletedSize() == 0, test, "service without completions keeps state");
+
+		uint8_t step = 0;
+		while (ring.Busy())
+		{
+			queue.Complete(1 + (step++ % 3));
+			ring.Service(backend);
+			Check(ring.GetInFlight() <= 3, test, "in flight within depth");
+		}
+
+		Check(ring.GetCompletedSize() == source.size(), test, "all bytes completed");
+		Check(capture.Bytes == source, test, "bytes in order");
+		Check(queue.ReuseErrors == 0, test, "no descriptor reused in flight");
+	}
+
+	/// <summary>
+	/// A failed queue call aborts the remaining data, in flight transactions still drain.
+	/// </summary>
+	void QueueFailure()
+	{
+		const char* test = "queue failure";
+		MockDmaQueue<4> queue{};
+		MockDmaQueue<4>::Backend backend{ queue };
+		DmaTransactionRing<MockDmaTransaction, 4> ring{};
+
+		const std::vector<uint8_t> source = MakeSource(100);
+		ring.SetDepth(2);
+		ring.Start(backend, source.data(), source.size(), 10);
+
+		queue.FailQueue = 1;
+		queue.Complete(1);
+		ring.Service(backend);
+		Check(ring.GetInFlight() == 1 && ring.Busy(), test, "in flight drains after failure");
+
+		queue.Complete(1);
+		Check(!ring.Service(backend), test, "done once drained");
+		Check(ring.GetCompletedSize() == 20, test, "completed size stops at the failure");
+
+		queue.FailQueue = 1;
+		Check(!ring.Start(backend, source.data(), source.size(), 10), test, "start fails if nothing queued");
+		Check(!ring.Busy(), test, "not busy after failed start");
+	}
+
+	/// <summary>
+	/// Ring deeper than the platform queue: the queue refuses, the remaining data is aborted.
+	/// Esp32Spi sizes the IDF queue from the ring depth so this doesn't happen.
+	/// </summary>
+	void QueueSmallerThanDepth()
+	{
+		const char* test = "queue smaller than depth";
+		MockDmaQueue<2> queue{};
+		MockDmaQueue<2>::Backend backend{ queue };
+		DmaTransactionRing<MockDmaTransaction, 4> ring{};
+
+		const std::vector<uint8_t> source = MakeSource(100);
+		ring.Start(backend, source.data(), source.size(), 10);
+		Check(ring.GetInFlight() == 2, test, "in flight capped by the queue");
+
+		queue.Complete(2);
+		Check(!ring.Service(backend), test, "done once drained");
+		Check(ring.GetCompletedSize() == 20, test, "completed size of queued data");
+	}
+
+	void InvalidStart()
+	{
+		const char* test = "invalid start";
+		MockDmaQueue<4> queue{};
+		MockDmaQueue<4>::Backend backend{ queue };
+		DmaTransactionRing<MockDmaTransaction, 4> ring{};
+		const uint8_t data[4]{};
+
+		Check(!ring.Start(backend, nullptr, 4, 2), test, "null data");
+		Check(!ring.Start(backend, data, 0, 2), test, "zero length");
+		Check(!ring.Start(backend, data, 4, 0), test, "zero chunk size");
+		Check(ring.Start(backend, data, 4, 2), test, "valid start");
+		Check(!ring.Start(backend, data, 4, 2), test, "start while busy");
+
+		ring.Clear();
+		Check(!ring.Busy() && ring.GetInFlight() == 0, test, "clear forgets state");
+	}
+}
+
+int main()
+{
+	StepThrough<4, 4>("exact chunks", 4, 400, 100);
+	StepThrough<4, 4>("short last chunk", 4, 430, 100);
+	StepThrough<4, 4>("wrap around", 3, 4096, 50);
+	StepThrough<16, 16>("depth 1", 1, 1000, 64);
+	StepThrough<16, 16>("depth 0 clamped", 0, 100, 64);
+	StepThrough<4, 8>("depth over capacity", 9, 1000, 30);
+	StepThrough<8, 8>("fewer chunks than depth", 8, 150, 64);
+	StepThrough<8, 8>("single byte", 8, 1, 64);
+	Bursts();
+	QueueFailure();
+	QueueSmallerThanDepth();
+	InvalidStart();
+
+	printf("DmaTransactionRing: %s, %u failed checks.\n", (Failures == 0) ? "pass" : "FAIL", (unsigned)Failures);
+
+	return (int)Failures;
+}
+#endif
\ No newline at end of file
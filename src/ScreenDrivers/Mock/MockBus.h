@@ -0,0 +1,159 @@
+#ifndef _EGFX_MOCK_BUS_h
+#define _EGFX_MOCK_BUS_h
+
+#if !defined(ARDUINO)
+#include "MockClock.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Mock bus timing model. Every byte and transaction is charged to the host virtual clock.
+	/// </summary>
+	struct MockBusTiming
+	{
+		/// <summary>
+		/// Bus clock in Hz. 0 to use the clock requested by the driver (SPI) or 400 kHz (I2C).
+		/// </summary>
+		uint32_t ClockHz = 0;
+
+		/// <summary>
+		/// Bits on the wire per byte, 8 for SPI, 9 for I2C (with ACK).
+		/// </summary>
+		uint8_t BitsPerByte = 8;
+
+		/// <summary>
+		/// Fixed cost per byte, models inter-byte gaps and driver overhead.
+		/// </summary>
+		uint32_t ByteOverheadNanos = 0;
+
+		/// <summary>
+		/// Fixed cost per transaction (CS/DC toggle, transaction setup or I2C start/address/stop).
+		/// </summary>
+		uint32_t TransactionOverheadNanos = 0;
+	};
+
+	/// <summary>
+	/// Mock bus counters, reset between measurements.
+	/// </summary>
+	struct MockBusStats
+	{
+		uint32_t Transactions = 0;
+		uint32_t CommandBytes = 0;
+		uint32_t DataBytes = 0;
+		uint64_t BusyNanos = 0;
+
+		uint32_t Bytes() const
+		{
+			return CommandBytes + DataBytes;
+		}
+
+		/// <summary>
+		/// Effective frame rate if the bus was the only cost, in milli-Hz.
+		/// </summary>
+		/// <param name="frames">Number of frames measured.</param>
+		uint32_t FramesPerSecondMilli(const uint32_t frames) const
+		{
+			if (BusyNanos == 0)
+			{
+				return 0;
+			}
+
+			return uint32_t(((uint64_t)frames * 1000000000000ULL) / BusyNanos);
+		}
+
+		void Clear()
+		{
+			Transactions = 0;
+			CommandBytes = 0;
+			DataBytes = 0;
+			BusyNanos = 0;
+		}
+	};
+
+	/// <summary>
+	/// Receives the bytes captured by a mock bus.
+	/// </summary>
+	class IMockBusListener
+	{
+	public:
+		virtual void OnBusStart() {}
+
+		/// <summary>
+		/// Called for every byte on the wire.
+		/// </summary>
+		/// <param name="value">Byte on the wire.</param>
+		/// <param name="data">SPI: DC line high. I2C: always false, the control byte is part of the stream.</param>
+		virtual void OnBusByte(const uint8_t value, const bool data) = 0;
+
+		virtual void OnBusEnd() {}
+	};
+
+	/// <summary>
+	/// Shared mock bus capture, timing and listener dispatch.
+	/// </summary>
+	class MockBus
+	{
+	public:
+		MockBusTiming Timing{};
+		MockBusStats Stats{};
+
+	protected:
+		IMockBusListener* Listener = nullptr;
+		uint32_t RequestedClockHz = 0;
+
+	public:
+		void SetListener(IMockBusListener* listener)
+		{
+			Listener = listener;
+		}
+
+	protected:
+		void BusStart()
+		{
+			Stats.Transactions++;
+			Charge(Timing.TransactionOverheadNanos);
+
+			if (Listener != nullptr)
+			{
+				Listener->OnBusStart();
+			}
+		}
+
+		void BusByte(const uint8_t value, const bool data)
+		{
+			if (data)
+			{
+				Stats.DataBytes++;
+			}
+			else
+			{
+				Stats.CommandBytes++;
+			}
+
+			const uint32_t clock = (Timing.ClockHz != 0) ? Timing.ClockHz : RequestedClockHz;
+			Charge(((clock > 0) ? ((uint64_t)Timing.BitsPerByte * 1000000000ULL) / clock : 0) + Timing.ByteOverheadNanos);
+
+			if (Listener != nullptr)
+			{
+				Listener->OnBusByte(value, data);
+			}
+		}
+
+		void BusEnd()
+		{
+			if (Listener != nullptr)
+			{
+				Listener->OnBusEnd();
+			}
+		}
+
+	private:
+		void Charge(const uint64_t nanos)
+		{
+			Stats.BusyNanos += nanos;
+			MockClock::Instance().Advance(nanos);
+		}
+	};
+}
+#endif
+#endif
\ No newline at end of file
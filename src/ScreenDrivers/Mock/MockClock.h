@@ -0,0 +1,72 @@
+#ifndef _EGFX_MOCK_CLOCK_h
+#define _EGFX_MOCK_CLOCK_h
+
+#if !defined(ARDUINO)
+#include <stdint.h>
+#include <atomic>
+
+namespace Egfx
+{
+	/// <summary>
+	/// Host virtual clock, in nanoseconds.
+	/// Advanced by the mock buses' timing model, by delays and by a fixed cost on every time read,
+	/// so polling loops always make progress.
+	/// Atomic, so RTOS driver stress tests can drive it from the buffer task thread.
+	/// </summary>
+	struct MockClock
+	{
+		std::atomic<uint64_t> Nanos{ 0 };
+
+		/// <summary>
+		/// Time charged on every micros()/millis() call, models the polling loop's CPU time.
+		/// </summary>
+		uint32_t ReadCostNanos = 1000;
+
+		void Advance(const uint64_t nanos)
+		{
+			Nanos.fetch_add(nanos, std::memory_order_relaxed);
+		}
+
+		uint32_t Read()
+		{
+			return uint32_t((Nanos.fetch_add(ReadCostNanos, std::memory_order_relaxed) + ReadCostNanos) / 1000);
+		}
+
+		void Reset()
+		{
+			Nanos.store(0, std::memory_order_relaxed);
+		}
+
+		static MockClock& Instance()
+		{
+			static MockClock clock{};
+
+			return clock;
+		}
+	};
+}
+
+/// <summary>
+/// Arduino time API, backed by the host virtual clock.
+/// </summary>
+inline uint32_t micros()
+{
+	return Egfx::MockClock::Instance().Read();
+}
+
+inline uint32_t millis()
+{
+	return micros() / 1000;
+}
+
+inline void delayMicroseconds(const uint32_t period)
+{
+	Egfx::MockClock::Instance().Advance((uint64_t)period * 1000);
+}
+
+inline void delay(const uint32_t period)
+{
+	Egfx::MockClock::Instance().Advance((uint64_t)period * 1000000);
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+#ifndef _EGFX_MOCK_DMA_QUEUE_h
+#define _EGFX_MOCK_DMA_QUEUE_h
+
+#if !defined(ARDUINO)
+#include <stddef.h>
+#include "MockBus.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Host transaction descriptor, stands in for spi_transaction_t.
+	/// </summary>
+	struct MockDmaTransaction
+	{
+		const uint8_t* Data = nullptr;
+		size_t Length = 0;
+	};
+
+	/// <summary>
+	/// Host stand-in for the IDF spi_master transaction queue, as Esp32Spi uses it with zero timeouts:
+	/// spi_device_queue_trans() and spi_device_get_trans_result().
+	/// Queued transactions are done by calling Complete(), in queue order, and their bytes go to the bus capture as data.
+	/// Also checks the caller's use of the queue: descriptors reused while in flight are counted as errors.
+	/// </summary>
+	/// <typeparam name="queueSize">Queue size, as spi_device_interface_config_t::queue_size.</typeparam>
+	template<uint8_t queueSize>
+	class MockDmaQueue : public MockBus
+	{
+	public:
+		static_assert(queueSize > 0, "MockDmaQueue size must be at least 1.");
+
+		/// <summary>
+		/// Backend for DmaTransactionRing, as Esp32Spi's IDF queue calls.
+		/// </summary>
+		struct Backend
+		{
+			MockDmaQueue& Device;
+
+			bool Queue(MockDmaTransaction& transaction, const uint8_t* data, const size_t length)
+			{
+				transaction.Data = data;
+				transaction.Length = length;
+
+				return Device.QueueTransaction(&transaction);
+			}
+
+			bool Reap()
+			{
+				MockDmaTransaction* done = nullptr;
+
+				return Device.GetTransactionResult(&done) && done != nullptr;
+			}
+		};
+
+	private:
+		// Queued transactions in order, the first DoneCount are done and waiting to be reaped.
+		MockDmaTransaction* Queued[queueSize]{};
+		uint8_t QueuedCount = 0;
+		uint8_t DoneCount = 0;
+
+	public:
+		/// <summary>
+		/// Fails the next queue calls, as a full or broken IDF queue would.
+		/// </summary>
+		uint8_t FailQueue = 0;
+
+		/// <summary>
+		/// Most transactions queued at once, done or not.
+		/// </summary>
+		uint8_t MaxQueued = 0;
+
+		/// <summary>
+		/// Descriptors queued again while in flight.
+		/// </summary>
+		uint32_t ReuseErrors = 0;
+
+	public:
+		MockDmaQueue() : MockBus() {}
+
+		/// <summary>
+		/// As spi_device_queue_trans(), with a zero timeout.
+		/// </summary>
+		/// <returns>False if the queue is full (ESP_ERR_TIMEOUT).</returns>
+		bool QueueTransaction(MockDmaTransaction* transaction)
+		{
+			if (FailQueue > 0)
+			{
+				FailQueue--;
+				return false;
+			}
+
+			if (QueuedCount >= queueSize)
+			{
+				return false;
+			}
+
+			for (uint8_t i = 0; i < QueuedCount; i++)
+			{
+				if (Queued[i] == transaction)
+				{
+					ReuseErrors++;
+				}
+			}
+
+			Queued[QueuedCount++] = transaction;
+			if (QueuedCount > MaxQueued)
+			{
+				MaxQueued = QueuedCount;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// As spi_device_get_trans_result(), with a zero timeout.
+		/// </summary>
+		/// <returns>False if no transaction is done (ESP_ERR_TIMEOUT).</returns>
+		bool GetTransactionResult(MockDmaTransaction** transaction)
+		{
+			if (DoneCount == 0)
+			{
+				return false;
+			}
+
+			*transaction = Queued[0];
+			for (uint8_t i = 1; i < QueuedCount; i++)
+			{
+				Queued[i - 1] = Queued[i];
+			}
+			QueuedCount--;
+			DoneCount--;
+			Queued[QueuedCount] = nullptr;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Transfers the next queued transactions, in order.
+		/// </summary>
+		/// <returns>Number of transactions done.</returns>
+		uint8_t Complete(const uint8_t count = 1)
+		{
+			uint8_t completed = 0;
+			while (completed < count && DoneCount < QueuedCount)
+			{
+				const MockDmaTransaction* transaction = Queued[DoneCount++];
+
+				BusStart();
+				for (size_t i = 0; i < transaction->Length; i++)
+				{
+					BusByte(transaction->Data[i], true);
+				}
+				BusEnd();
+
+				completed++;
+			}
+
+			return completed;
+		}
+
+		/// <summary>
+		/// Queued transactions not done yet.
+		/// </summary>
+		uint8_t GetPending() const
+		{
+			return QueuedCount - DoneCount;
+		}
+
+		/// <summary>
+		/// Done transactions waiting to be reaped.
+		/// </summary>
+		uint8_t GetDone() const
+		{
+			return DoneCount;
+		}
+	};
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,461 @@
+#ifndef _EGFX_MOCK_PANEL_h
+#define _EGFX_MOCK_PANEL_h
+
+#if !defined(ARDUINO)
+#include "MockBus.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Emulated RAM of a MIPI DCS style controller (ST7789, ST7735, GC9A01, GC9107).
+	/// Decodes window (CASET/RASET), pixel format and memory writes from the captured SPI bytes.
+	/// Pixels are stored in the wire format: 5-6-5 for 16 bit, 4-4-4 for 12 bit.
+	/// Memory access control (MADCTL) is recorded but not applied: RAM is addressed as the host sees it.
+	/// </summary>
+	/// <typeparam name="columns">Column address range.</typeparam>
+	/// <typeparam name="rows">Row address range.</typeparam>
+	template<uint16_t columns, uint16_t rows>
+	class MockPanelDcs : public IMockBusListener
+	{
+	private:
+		enum class CommandEnum : uint8_t
+		{
+			SoftwareReset = 0x01,
+			SleepIn = 0x10,
+			SleepOut = 0x11,
+			DisplayOff = 0x28,
+			DisplayOn = 0x29,
+			ColumnAddress = 0x2A,
+			RowAddress = 0x2B,
+			MemoryWrite = 0x2C,
+			VerticalScrollingDefinition = 0x33,
+			MemoryAccessControl = 0x36,
+			VerticalScrollStartAddress = 0x37,
+			PixelFormat = 0x3A,
+			MemoryWriteContinue = 0x3C
+		};
+
+	public:
+		uint16_t Ram[(size_t)columns * rows]{};
+
+		uint16_t ColumnStart = 0;
+		uint16_t ColumnEnd = columns - 1;
+		uint16_t RowStart = 0;
+		uint16_t RowEnd = rows - 1;
+
+		uint16_t ScrollTop = 0;
+		uint16_t ScrollHeight = rows;
+		uint16_t ScrollStart = 0;
+
+		uint8_t ColorDepth = 16;
+		uint8_t MemoryAccess = 0;
+		bool Awake = false;
+		bool DisplayEnabled = false;
+
+		uint32_t MemoryWrites = 0;
+		uint32_t PixelWrites = 0;
+		uint32_t OutOfRangeWrites = 0;
+
+	private:
+		uint8_t Params[6]{};
+		uint8_t Command = 0;
+		uint8_t ParamIndex = 0;
+
+		uint16_t X = 0;
+		uint16_t Y = 0;
+		uint8_t PixelBytes[3]{};
+		uint8_t PixelIndex = 0;
+
+	public:
+		uint16_t GetPixel(const uint16_t x, const uint16_t y) const
+		{
+			return Ram[((size_t)columns * y) + x];
+		}
+
+		void Clear()
+		{
+			for (size_t i = 0; i < (size_t)columns * rows; i++)
+			{
+				Ram[i] = 0;
+			}
+			MemoryWrites = 0;
+			PixelWrites = 0;
+			OutOfRangeWrites = 0;
+		}
+
+		void OnBusByte(const uint8_t value, const bool data) final
+		{
+			if (data)
+			{
+				OnData(value);
+			}
+			else
+			{
+				OnCommand(value);
+			}
+		}
+
+	private:
+		void OnCommand(const uint8_t value)
+		{
+			Command = value;
+			ParamIndex = 0;
+			PixelIndex = 0;
+
+			switch ((CommandEnum)value)
+			{
+			case CommandEnum::SoftwareReset:
+				ColumnStart = 0;
+				ColumnEnd = columns - 1;
+				RowStart = 0;
+				RowEnd = rows - 1;
+				ScrollTop = 0;
+				ScrollHeight = rows;
+				ScrollStart = 0;
+				Awake = false;
+				DisplayEnabled = false;
+				break;
+			case CommandEnum::SleepIn:
+				Awake = false;
+				break;
+			case CommandEnum::SleepOut:
+				Awake = true;
+				break;
+			case CommandEnum::DisplayOff:
+				DisplayEnabled = false;
+				break;
+			case CommandEnum::DisplayOn:
+				DisplayEnabled = true;
+				break;
+			case CommandEnum::MemoryWrite:
+				MemoryWrites++;
+				X = ColumnStart;
+				Y = RowStart;
+				break;
+			default:
+				break;
+			}
+		}
+
+		void OnData(const uint8_t value)
+		{
+			switch ((CommandEnum)Command)
+			{
+			case CommandEnum::MemoryWrite:
+			case CommandEnum::MemoryWriteContinue:
+				OnPixelByte(value);
+				return;
+			default:
+				break;
+			}
+
+			if (ParamIndex >= sizeof(Params))
+			{
+				return;
+			}
+			Params[ParamIndex++] = value;
+
+			switch ((CommandEnum)Command)
+			{
+			case CommandEnum::ColumnAddress:
+				if (ParamIndex == 4)
+				{
+					ColumnStart = ((uint16_t)Params[0] << 8) | Params[1];
+					ColumnEnd = ((uint16_t)Params[2] << 8) | Params[3];
+				}
+				break;
+			case CommandEnum::RowAddress:
+				if (ParamIndex == 4)
+				{
+					RowStart = ((uint16_t)Params[0] << 8) | Params[1];
+					RowEnd = ((uint16_t)Params[2] << 8) | Params[3];
+				}
+				break;
+			case CommandEnum::PixelFormat:
+				ColorDepth = ((value & 0x07) == 0x03) ? 12 : 16;
+				break;
+			case CommandEnum::MemoryAccessControl:
+				MemoryAccess = value;
+				break;
+			case CommandEnum::VerticalScrollingDefinition:
+				if (ParamIndex == 4)
+				{
+					ScrollTop = ((uint16_t)Params[0] << 8) | Params[1];
+					ScrollHeight = ((uint16_t)Params[2] << 8) | Params[3];
+				}
+				break;
+			case CommandEnum::VerticalScrollStartAddress:
+				if (ParamIndex == 2)
+				{
+					ScrollStart = ((uint16_t)Params[0] << 8) | Params[1];
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		void OnPixelByte(const uint8_t value)
+		{
+			PixelBytes[PixelIndex++] = value;
+
+			if (ColorDepth == 12)
+			{
+				// RG BR GB, 2 pixels every 3 bytes.
+				if (PixelIndex == 2)
+				{
+					WritePixel(((uint16_t)PixelBytes[0] << 4) | (PixelBytes[1] >> 4));
+				}
+				else if (PixelIndex == 3)
+				{
+					WritePixel(((uint16_t)(PixelBytes[1] & 0x0F) << 8) | PixelBytes[2]);
+					PixelIndex = 0;
+				}
+			}
+			else if (PixelIndex == 2)
+			{
+				WritePixel(((uint16_t)PixelBytes[0] << 8) | PixelBytes[1]);
+				PixelIndex = 0;
+			}
+		}
+
+		void WritePixel(const uint16_t color)
+		{
+			if (X < columns && Y < rows)
+			{
+				Ram[((size_t)columns * Y) + X] = color;
+				PixelWrites++;
+			}
+			else
+			{
+				OutOfRangeWrites++;
+			}
+
+			if (X >= ColumnEnd)
+			{
+				X = ColumnStart;
+				Y = (Y >= RowEnd) ? RowStart : Y + 1;
+			}
+			else
+			{
+				X++;
+			}
+		}
+	};
+
+	/// <summary>
+	/// Emulated RAM of a page addressed monochrome controller (SSD1306, SH1106).
+	/// Decodes page/column addressing and data writes, from SPI (DC line) or I2C (control byte) streams.
+	/// </summary>
+	/// <typeparam name="columns">Column address range.</typeparam>
+	/// <typeparam name="pages">Number of 8 pixel pages.</typeparam>
+	template<uint8_t columns, uint8_t pages>
+	class MockPanelPaged : public IMockBusListener
+	{
+	private:
+		enum class ControlEnum : uint8_t
+		{
+			Command = 0x00,
+			Data = 0x40
+		};
+
+	public:
+		uint8_t Ram[(size_t)columns * pages]{};
+
+		uint8_t ColumnStart = 0;
+		uint8_t ColumnEnd = columns - 1;
+		uint8_t PageStart = 0;
+		uint8_t PageEnd = pages - 1;
+		bool HorizontalAddressing = false;
+		bool DisplayEnabled = false;
+
+		uint32_t DataWrites = 0;
+		uint32_t OutOfRangeWrites = 0;
+
+	private:
+		const bool I2C;
+
+		uint8_t Command = 0;
+		uint8_t ParamCount = 0;
+		uint8_t ParamIndex = 0;
+		uint8_t Params[6]{};
+
+		uint8_t Column = 0;
+		uint8_t Page = 0;
+
+		bool ControlPending = false;
+		bool DataStream = false;
+
+	public:
+		/// <param name="i2c">True for I2C streams, where each transmission starts with a control byte.</param>
+		MockPanelPaged(const bool i2c = false)
+			: IMockBusListener()
+			, I2C(i2c)
+		{
+		}
+
+		bool GetPixel(const uint8_t x, const uint8_t y) const
+		{
+			return (Ram[((size_t)columns * (y >> 3)) + x] >> (y & 7)) & 1;
+		}
+
+		void OnBusStart() final
+		{
+			ControlPending = I2C;
+		}
+
+		void OnBusByte(const uint8_t value, const bool data) final
+		{
+			if (I2C)
+			{
+				if (ControlPending)
+				{
+					ControlPending = false;
+					DataStream = (value & (uint8_t)ControlEnum::Data) != 0;
+					return;
+				}
+			}
+			else
+			{
+				DataStream = data;
+			}
+
+			if (DataStream)
+			{
+				OnData(value);
+			}
+			else
+			{
+				OnCommand(value);
+			}
+		}
+
+	private:
+		void OnData(const uint8_t value)
+		{
+			if (Column < columns && Page < pages)
+			{
+				Ram[((size_t)columns * Page) + Column] = value;
+				DataWrites++;
+			}
+			else
+			{
+				OutOfRangeWrites++;
+			}
+
+			if (HorizontalAddressing)
+			{
+				if (Column >= ColumnEnd)
+				{
+					Column = ColumnStart;
+					Page = (Page >= PageEnd) ? PageStart : Page + 1;
+				}
+				else
+				{
+					Column++;
+				}
+			}
+			else
+			{
+				Column++;
+			}
+		}
+
+		void OnCommand(const uint8_t value)
+		{
+			if (ParamIndex < ParamCount)
+			{
+				Params[ParamIndex++] = value;
+				if (ParamIndex == ParamCount)
+				{
+					OnCommandComplete();
+				}
+				return;
+			}
+
+			Command = value;
+			ParamIndex = 0;
+			ParamCount = GetParamCount(value);
+
+			if (ParamCount == 0)
+			{
+				OnCommandComplete();
+			}
+		}
+
+		void OnCommandComplete()
+		{
+			if (Command <= 0x0F)
+			{
+				Column = (Column & 0xF0) | Command;
+			}
+			else if (Command <= 0x1F)
+			{
+				Column = (Column & 0x0F) | ((Command & 0x0F) << 4);
+			}
+			else if (Command >= 0xB0 && Command <= 0xB7)
+			{
+				Page = Command & 0x07;
+			}
+			else
+			{
+				switch (Command)
+				{
+				case 0x20:
+					HorizontalAddressing = (Params[0] & 0x03) == 0x00;
+					break;
+				case 0x21:
+					ColumnStart = Params[0];
+					ColumnEnd = Params[1];
+					Column = ColumnStart;
+					break;
+				case 0x22:
+					PageStart = Params[0] & 0x07;
+					PageEnd = Params[1] & 0x07;
+					Page = PageStart;
+					break;
+				case 0xAE:
+					DisplayEnabled = false;
+					break;
+				case 0xAF:
+					DisplayEnabled = true;
+					break;
+				default:
+					break;
+				}
+			}
+		}
+
+		static uint8_t GetParamCount(const uint8_t command)
+		{
+			switch (command)
+			{
+			case 0x20:
+			case 0x81:
+			case 0x8D:
+			case 0xA8:
+			case 0xAD:
+			case 0xD3:
+			case 0xD5:
+			case 0xD9:
+			case 0xDA:
+			case 0xDB:
+				return 1;
+			case 0x21:
+			case 0x22:
+			case 0xA3:
+				return 2;
+			case 0x29:
+			case 0x2A:
+				return 5;
+			case 0x26:
+			case 0x27:
+				return 6;
+			default:
+				return 0;
+			}
+		}
+	};
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef _EGFX_MOCK_SPI_h
+#define _EGFX_MOCK_SPI_h
+
+#if !defined(ARDUINO)
+#include <stddef.h>
+#include "MockBus.h"
+#include "../GpioPin.h"
+
+#if !defined(MSBFIRST)
+#define MSBFIRST 1
+#endif
+#if !defined(SPI_MODE0)
+#define SPI_MODE0 0x00
+#endif
+
+/// <summary>
+/// Host SPI settings, as the Arduino SPI API.
+/// </summary>
+class SPISettings
+{
+public:
+	uint32_t Clock = 0;
+	uint8_t BitOrder = MSBFIRST;
+	uint8_t DataMode = SPI_MODE0;
+
+public:
+	SPISettings() {}
+
+	SPISettings(const uint32_t clock, const uint8_t bitOrder, const uint8_t dataMode)
+		: Clock(clock)
+		, BitOrder(bitOrder)
+		, DataMode(dataMode)
+	{
+	}
+};
+
+namespace Egfx
+{
+	/// <summary>
+	/// Host mock SPI, with the Arduino SPI interface used by the screen drivers.
+	/// Captures every byte with the DC line level, read from the mock GPIO state.
+	/// Received bytes are not written back to transfer buffers.
+	/// </summary>
+	class MockSpi : public MockBus
+	{
+	private:
+		uint8_t PinDC;
+		bool InTransaction = false;
+
+	public:
+		/// <param name="pinDC">Driver DC pin, to tell command from data bytes.</param>
+		MockSpi(const uint8_t pinDC = UINT8_MAX)
+			: MockBus()
+			, PinDC(pinDC)
+		{
+		}
+
+		void begin() {}
+		void end() {}
+
+		void beginTransaction(const SPISettings& settings)
+		{
+			RequestedClockHz = settings.Clock;
+			InTransaction = true;
+			BusStart();
+		}
+
+		void endTransaction()
+		{
+			InTransaction = false;
+			BusEnd();
+		}
+
+		uint8_t transfer(const uint8_t value)
+		{
+			BusByte(value, IsData());
+
+			return 0;
+		}
+
+		void transfer(void* buffer, const size_t size)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+			const bool data = IsData();
+			for (size_t i = 0; i < size; i++)
+			{
+				BusByte(bytes[i], data);
+			}
+		}
+
+		bool IsInTransaction() const
+		{
+			return InTransaction;
+		}
+
+	private:
+		bool IsData() const
+		{
+			return PinDC < UINT8_MAX && MockGpioLog::Instance().Levels[PinDC] != 0;
+		}
+	};
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef _EGFX_MOCK_WIRE_h
+#define _EGFX_MOCK_WIRE_h
+
+#if !defined(ARDUINO)
+#include <stddef.h>
+#include "MockBus.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Host mock I2C, with the Arduino Wire interface used by the screen drivers.
+	/// Captures every written byte, with the address byte charged as transaction overhead.
+	/// </summary>
+	class MockWire : public MockBus
+	{
+	public:
+		static constexpr uint32_t DefaultClock = 400000;
+
+	private:
+		uint8_t Address = 0;
+
+	public:
+		MockWire()
+			: MockBus()
+		{
+			Timing.BitsPerByte = 9;
+			RequestedClockHz = DefaultClock;
+		}
+
+		void begin() {}
+		void end() {}
+
+		void setClock(const uint32_t clock)
+		{
+			RequestedClockHz = clock;
+		}
+
+		void beginTransmission(const uint8_t address)
+		{
+			Address = address;
+			BusStart();
+		}
+
+		uint8_t endTransmission(const bool /*sendStop*/ = true)
+		{
+			BusEnd();
+
+			return 0;
+		}
+
+		size_t write(const uint8_t value)
+		{
+			BusByte(value, false);
+
+			return 1;
+		}
+
+		size_t write(const uint8_t* buffer, const size_t size)
+		{
+			for (size_t i = 0; i < size; i++)
+			{
+				BusByte(buffer[i], false);
+			}
+
+			return size;
+		}
+
+		uint8_t GetAddress() const
+		{
+			return Address;
+		}
+	};
+}
+#endif
+#endif
\ No newline at end of file
@@ -0,0 +1,209 @@
+#ifndef _EGFX_RTOS_TASK_h
+#define _EGFX_RTOS_TASK_h
+
+#include <stdint.h>
+#include <atomic>
+
+#if defined(ARDUINO)
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_NRF52)
+#include <Arduino.h>
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52)
+#include <FreeRTOS.h>
+#include <task.h>
+#endif
+#else
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+/// <summary>
+/// Host stand-in for the FreeRTOS priority type, used by the RTOS driver templates.
+/// </summary>
+typedef unsigned int UBaseType_t;
+#endif
+
+namespace Egfx
+{
+#if defined(ARDUINO)
+	/// <summary>
+	/// Thin portability layer over a FreeRTOS worker task, with notification wake-up.
+	/// The host build implements the same contract with std::thread, for stress testing.
+	/// </summary>
+	class RtosTask
+	{
+	private:
+		TaskHandle_t Handle = NULL;
+		std::atomic<bool> Exited{ true };
+
+	public:
+		/// <summary>
+		/// Creates the task. The entry function must end with Exit().
+		/// </summary>
+		bool Start(TaskFunction_t entry, void* parameter, const uint32_t stackHeight, const UBaseType_t priority, const uint32_t coreAffinity)
+		{
+			if (Handle != NULL || entry == nullptr)
+			{
+				return false;
+			}
+
+			Exited.store(false, std::memory_order_release);
+
+#if defined(ARDUINO_ARCH_ESP32)
+			xTaskCreatePinnedToCore(entry, "BufferTask", stackHeight, parameter, priority, &Handle, coreAffinity);
+#elif defined(ARDUINO_ARCH_RP2040)
+			xTaskCreateAffinitySet(entry, "BufferTask", stackHeight, parameter, priority, coreAffinity, &Handle);
+#else // ESP8266, NRF52, others with FreeRTOS
+			xTaskCreate(entry, "BufferTask", stackHeight, parameter, priority, &Handle);
+#endif
+			if (Handle == NULL)
+			{
+				Exited.store(true, std::memory_order_release);
+
+				return false;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Wakes the task. Notifications count, no lost wake-ups.
+		/// </summary>
+		void Notify()
+		{
+			if (Handle != NULL)
+			{
+				xTaskNotifyGive(Handle);
+			}
+		}
+
+		/// <summary>
+		/// Called from the task, blocks until notified.
+		/// </summary>
+		void Wait()
+		{
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		}
+
+		/// <summary>
+		/// Called from the task entry as its last statement. Does not return on FreeRTOS.
+		/// </summary>
+		void Exit()
+		{
+			Exited.store(true, std::memory_order_release);
+			vTaskDelete(NULL);
+		}
+
+		/// <summary>
+		/// Waits for the task to reach Exit(), after it was asked to stop.
+		/// </summary>
+		void Join()
+		{
+			if (Handle != NULL)
+			{
+				while (!Exited.load(std::memory_order_acquire))
+				{
+					vTaskDelay(1);
+				}
+				Handle = NULL;
+			}
+		}
+
+		static void Sleep(const uint32_t micros)
+		{
+			const TickType_t ticks = pdMS_TO_TICKS(micros / 1000);
+			if (ticks > 0)
+			{
+				vTaskDelay(ticks);
+			}
+		}
+
+		/// <summary>
+		/// Yields for the shortest period (1 tick).
+		/// </summary>
+		static void Yield()
+		{
+			vTaskDelay(1);
+		}
+	};
+#else
+	/// <summary>
+	/// Host implementation of the RTOS worker task, with std::thread.
+	/// Priority, stack and affinity are ignored.
+	/// </summary>
+	class RtosTask
+	{
+	private:
+		std::thread Thread;
+		std::mutex NotifyMutex;
+		std::condition_variable NotifyCondition;
+		uint32_t Notifications = 0;
+
+	public:
+		~RtosTask()
+		{
+			if (Thread.joinable())
+			{
+				Thread.detach();
+			}
+		}
+
+		bool Start(void (*entry)(void* parameter), void* parameter, const uint32_t /*stackHeight*/, const UBaseType_t /*priority*/, const uint32_t /*coreAffinity*/)
+		{
+			if (Thread.joinable() || entry == nullptr)
+			{
+				return false;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(NotifyMutex);
+				Notifications = 0;
+			}
+			Thread = std::thread(entry, parameter);
+
+			return true;
+		}
+
+		void Notify()
+		{
+			{
+				std::lock_guard<std::mutex> lock(NotifyMutex);
+				Notifications++;
+			}
+			NotifyCondition.notify_one();
+		}
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(NotifyMutex);
+			NotifyCondition.wait(lock, [this] { return Notifications > 0; });
+			Notifications = 0;
+		}
+
+		void Exit()
+		{
+		}
+
+		void Join()
+		{
+			if (Thread.joinable())
+			{
+				Thread.join();
+			}
+		}
+
+		static void Sleep(const uint32_t micros)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(micros));
+		}
+
+		static void Yield()
+		{
+			std::this_thread::yield();
+		}
+	};
+#endif
+}
+#endif
\ No newline at end of file
@@ -2,9 +2,11 @@
 #define _SH1106_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace SH1106
 {
+	// Kept for user code, the driver runs Init::Sequence.
 	static constexpr uint8_t ConfigBatch[]{ 0x00, 0xAE, 0xD5, 0x80, 0xA8, 0x3F, 0xD3, 0x00, 0x40, 0xAD, 0x8B, 0xA1, 0xC8, 0xDA, 0x12, 0x81, 0xFF, 0xD9, 0x1F, 0xDB, 0x40, 0x33, 0xA6, 0x20, 0x10, 0xA4 };
 
 	static constexpr uint8_t I2CAddress = 0x3C;
@@ -26,6 +28,24 @@ namespace SH1106
 		PushAddress = 0x10,
 		DisplayOn = 0xAF
 	};
+
+	namespace Init
+	{
+		namespace InitSequence = Egfx::InitSequence;
+
+		static constexpr uint8_t Sequence[] PROGMEM
+		{
+			InitSequence::Reset, 0, 0,
+			InitSequence::Delay, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+			InitSequence::Commands + 26,
+			0x00, 0xAE, 0xD5, 0x80, 0xA8, 0x3F, 0xD3, 0x00, 0x40, 0xAD, 0x8B, 0xA1, 0xC8, 0xDA, 0x12, 0x81, 0xFF, 0xD9, 0x1F, 0xDB, 0x40, 0x33, 0xA6, 0x20, 0x10, 0xA4,
+			InitSequence::Delay, InitSequence::PeriodHigh(BOOT_DELAY_MICROS), InitSequence::PeriodLow(BOOT_DELAY_MICROS),
+			InitSequence::Commands + 2,
+			(uint8_t)CommandEnum::CommandStart,
+			(uint8_t)CommandEnum::DisplayOn,
+			InitSequence::End
+		};
+	}
 }
 
 namespace SH1106_128x64
@@ -2,6 +2,7 @@
 #define _SH1107_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace SH1107
 {
@@ -17,6 +18,7 @@ namespace SH1107
 	static constexpr uint8_t Pages = (Height + 7) / 8;
 	static constexpr uint16_t PageChunkSize = Width;
 
+	// Kept for user code, the driver runs Init::Sequence.
 	static constexpr uint8_t ConfigBatch[]
 	{
 		0x00,
@@ -44,6 +46,31 @@ namespace SH1107
 		DisplayOn = 0xAF,
 		DisplayOff = 0xAE,
 	};
+
+	namespace Init
+	{
+		namespace InitSequence = Egfx::InitSequence;
+
+		// Init varies by module, this is a common 128x128 configuration.
+		static constexpr uint8_t Sequence[] PROGMEM
+		{
+			InitSequence::Delay, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+			InitSequence::Commands + 15,
+			0x00,
+			0xAE, // Display OFF
+			0xA8, 0x7F, // Multiplex ratio = 0x7F (128)
+			0xD3, 0x00, // Display offset
+			0x40, // Display start line
+			0xA1, // Segment remap
+			0xC8, // COM scan direction
+			0xDA, 0x12, // COM pins
+			0x81, 0xFF, // Contrast
+			0xA6, // Normal display (not inverted)
+			0xAF, // Display ON
+			InitSequence::Delay, InitSequence::PeriodHigh(BOOT_DELAY_MICROS), InitSequence::PeriodLow(BOOT_DELAY_MICROS),
+			InitSequence::End
+		};
+	}
 }
 
 #endif
\ No newline at end of file
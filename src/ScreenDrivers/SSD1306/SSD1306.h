@@ -2,9 +2,11 @@
 #define _SSD1306_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace SSD1306
 {
+	// Kept for user code, the driver runs Init::Sequence.
 	static constexpr uint8_t ConfigBatch[]{ 0x00, 0xAE, 0x20, 0x00, 0xC8, 0x40, 0x81, 0x7F, 0xA1, 0xA6, 0xA8, 0x3F, 0xD3, 0x00, 0xD5, 0x80, 0xD9, 0x22, 0xDA, 0x12, 0xDB, 0x20, 0x8D, 0x14, 0xA4, 0xAF };
 
 	static constexpr uint8_t I2CAddress = 0x3C;
@@ -158,6 +160,33 @@ namespace SSD1306
 		/// </summary>
 		SetVerticalScrollArea = 0xA3,
 	};
+
+	namespace Init
+	{
+		namespace InitSequence = Egfx::InitSequence;
+
+		/// <summary>
+		/// Init sequence, with the panel height's multiplex ratio and COM pins.
+		/// </summary>
+		template<const uint8_t height, const uint8_t comPins>
+		struct Sequence
+		{
+			static constexpr uint8_t Data[] PROGMEM
+			{
+				InitSequence::Reset, InitSequence::PeriodHigh(RESET_WAIT_MICROS), InitSequence::PeriodLow(RESET_WAIT_MICROS),
+				InitSequence::Delay, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+				InitSequence::Commands + 25,
+				0xAE, 0x20, 0x00, 0xC8, 0x40, 0x81, 0x7F, 0xA1, 0xA6, 0xA8, 0x3F, 0xD3, 0x00, 0xD5, 0x80, 0xD9, 0x22, 0xDA, 0x12, 0xDB, 0x20, 0x8D, 0x14, 0xA4, 0xAF,
+				InitSequence::Commands + 4,
+				(uint8_t)CommandEnum::SetMultiplexRatio, uint8_t(height - 1),
+				(uint8_t)CommandEnum::SetComPins, comPins,
+				InitSequence::End
+			};
+		};
+
+		template<const uint8_t height, const uint8_t comPins>
+		constexpr uint8_t Sequence<height, comPins>::Data[];
+	}
 }
 
 namespace SSD1306_128x64
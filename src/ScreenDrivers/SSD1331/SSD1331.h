@@ -2,6 +2,7 @@
 #define _SSD1331_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace SSD1331
 {
@@ -14,10 +15,26 @@ namespace SSD1331
 	static constexpr uint8_t MapRgb332 = 0x32;
 	static constexpr uint8_t MapRgb565 = 0x72;
 
+	/// <summary>
+	/// Conservative completion time for hardware graphic commands.
+	/// The controller ignores further RAM access until the command completes.
+	/// </summary>
+	static constexpr uint16_t DRAW_LINE_MICROS = 1000;
+	static constexpr uint16_t DRAW_RECTANGLE_MICROS = 3000;
+	static constexpr uint16_t COPY_MICROS = 3000;
+	static constexpr uint16_t CLEAR_WINDOW_MICROS = 1000;
+
+	static constexpr uint8_t FillEnable = 0x01;
+
 	enum class CommandEnum : uint8_t
 	{
 		SetColumnAddress = 0x15,
 		DrawLine = 0x21,
+		DrawRectangle = 0x22,
+		Copy = 0x23,
+		DimWindow = 0x24,
+		ClearWindow = 0x25,
+		SetFillMode = 0x26,
 		SetRowAddress = 0x75,
 		SetContrastRed = 0x81,
 		SetContrastGreen = 0x82,
@@ -43,6 +60,7 @@ namespace SSD1331
 		Nop = 0xE3,
 	};
 
+	// Kept for user code, the driver runs Init::Sequence.
 	static constexpr uint8_t CommonConfigBatch[]
 	{
 		(uint8_t)CommandEnum::SetStartLine, 0x00,
@@ -65,5 +83,50 @@ namespace SSD1331
 		(uint8_t)CommandEnum::SetRowAddress, 0, Height - 1,
 		(uint8_t)CommandEnum::DisplayOn
 	};
+
+	namespace Init
+	{
+		namespace InitSequence = Egfx::InitSequence;
+
+		/// <summary>
+		/// Init sequence, with the RAM color mapping of the pixel format.
+		/// </summary>
+		template<const uint8_t rgbMode>
+		struct Sequence
+		{
+			static constexpr uint8_t Data[] PROGMEM
+			{
+				InitSequence::Reset, InitSequence::PeriodHigh(RESET_WAIT_MICROS), InitSequence::PeriodLow(RESET_WAIT_MICROS),
+				InitSequence::Delay, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+				InitSequence::Commands + 43,
+				(uint8_t)CommandEnum::DisplayOff,
+				(uint8_t)CommandEnum::RemapAndColor, rgbMode,
+				(uint8_t)CommandEnum::SetStartLine, 0x00,
+				(uint8_t)CommandEnum::SetDisplayOffset, 0x00,
+				(uint8_t)CommandEnum::SetDisplayModeNormal,
+				(uint8_t)CommandEnum::SetMuxRatio, 63,
+				(uint8_t)CommandEnum::SetMasterConfiguration, 0x8E,
+				(uint8_t)CommandEnum::SetPowerSaveMode, 0x0B,
+				(uint8_t)CommandEnum::SetPhasesPeriodAdjustment, 0x31,
+				(uint8_t)CommandEnum::SetDisplayClockDivider, 0xF0,
+				(uint8_t)CommandEnum::SetPrechargeSpeed1, 0x64,
+				(uint8_t)CommandEnum::SetPrechargeSpeed2, 0x78,
+				(uint8_t)CommandEnum::SetPrechargeVoltage, 0x3A,
+				(uint8_t)CommandEnum::SetVCOMH, 0x3E,
+				(uint8_t)CommandEnum::SetMasterCurrentAF, 0x09,
+				(uint8_t)CommandEnum::SetContrastRed, 0x91,
+				(uint8_t)CommandEnum::SetContrastGreen, 0x50,
+				(uint8_t)CommandEnum::SetContrastBlue, 0x7D,
+				(uint8_t)CommandEnum::SetFillMode, FillEnable,
+				(uint8_t)CommandEnum::SetColumnAddress, 0, Width - 1,
+				(uint8_t)CommandEnum::SetRowAddress, 0, Height - 1,
+				(uint8_t)CommandEnum::DisplayOn,
+				InitSequence::End
+			};
+		};
+
+		template<const uint8_t rgbMode>
+		constexpr uint8_t Sequence<rgbMode>::Data[];
+	}
 }
 #endif
\ No newline at end of file
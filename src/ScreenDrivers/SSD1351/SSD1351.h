@@ -2,6 +2,7 @@
 #define _SSD1351_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace SSD1351
 {
@@ -53,6 +54,7 @@ namespace SSD1351
 		Nop4 = 0xE3
 	};
 
+	// Kept for user code, the driver runs Init::Sequence.
 	static constexpr uint8_t CommonCommandArgBatch[]
 	{
 		(uint8_t)CommandEnum::SetDisplayClockDivider, 0xF1,
@@ -66,5 +68,40 @@ namespace SSD1351
 		(uint8_t)CommandEnum::SetVCOMH, 0x05,
 		(uint8_t)CommandEnum::SetPrechargeVoltage, 0x17
 	};
+
+	namespace Init
+	{
+		namespace InitSequence = Egfx::InitSequence;
+
+		static constexpr uint8_t Sequence[] PROGMEM
+		{
+			InitSequence::Reset, 0, 0,
+			InitSequence::Delay, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+			1, (uint8_t)CommandEnum::Unlock, 0x12,
+			1, (uint8_t)CommandEnum::Unlock, 0xB1,
+			0, (uint8_t)CommandEnum::SetSleepOn,
+			1, (uint8_t)CommandEnum::SetDisplayClockDivider, 0xF1,
+			1, (uint8_t)CommandEnum::SetMuxRatio, 127,
+			1, (uint8_t)CommandEnum::RemapAndColor, 0x34,
+			1, (uint8_t)CommandEnum::SetStartLine, 0x00,
+			1, (uint8_t)CommandEnum::SetDisplayOffset, 0x00,
+			1, (uint8_t)CommandEnum::SetGPIO, 0x0,
+			1, (uint8_t)CommandEnum::SetFunction, 0x00,
+			1, (uint8_t)CommandEnum::SetPrechargeSpeed1, 0x32,
+			1, (uint8_t)CommandEnum::SetVCOMH, 0x05,
+			1, (uint8_t)CommandEnum::SetPrechargeVoltage, 0x17,
+			0, (uint8_t)CommandEnum::SetDisplayModeNormal,
+			3, (uint8_t)CommandEnum::SetContrastA, 0xC8, 0x80, 0xC8,
+			1, (uint8_t)CommandEnum::SetMasterCurrentAF, 0x0F,
+			3, (uint8_t)CommandEnum::SetSegmentLowVoltage, 0xA0, 0xB5, 0x55,
+			1, (uint8_t)CommandEnum::SetPrechargeSpeed2, 0x01,
+			InitSequence::Commands + 2,
+			(uint8_t)CommandEnum::SetSleepOff,
+			(uint8_t)CommandEnum::SetDisplayModeNormal,
+			2, (uint8_t)CommandEnum::SetColumnAddress, 0, Width - 1,
+			2, (uint8_t)CommandEnum::SetRowAddress, 0, Height - 1,
+			InitSequence::End
+		};
+	}
 }
 #endif
\ No newline at end of file
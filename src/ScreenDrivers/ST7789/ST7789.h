@@ -25,6 +25,20 @@ namespace ST7789
 	static constexpr size_t SpiMaxChunkSize = SIZE_MAX;
 #endif
 
+	namespace PixelFormats
+	{
+		static constexpr uint8_t Rgb444 = 0x53;
+		static constexpr uint8_t Rgb565 = 0x55;
+	}
+
+	/// <summary>
+	/// Interface pixel format for the pushed color depth (12 or 16 bit).
+	/// </summary>
+	static constexpr uint8_t PixelFormat(const uint8_t colorDepth)
+	{
+		return colorDepth == 12 ? PixelFormats::Rgb444 : PixelFormats::Rgb565;
+	}
+
 	enum class CommandEnum : uint8_t
 	{
 		Nop = 0x00,
@@ -43,6 +57,8 @@ namespace ST7789
 		SetRowAddress = 0x2B,
 		MemoryWrite = 0x2C,
 		MemoryRead = 0x2E,
+		VerticalScrollingDefinition = 0x33,
+		VerticalScrollStartAddress = 0x37,
 		SetPixelFormat = 0x3A,
 		SetMemoryDataAccessControl = 0x36,
 		SetFrameRateControl1 = 0xB3,
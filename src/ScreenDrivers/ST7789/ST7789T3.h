@@ -2,6 +2,7 @@
 #define _EGFX_SCREEN_DRIVERS_ST7789T3_h
 
 #include <stdint.h>
+#include "../InitSequence.h"
 
 namespace Egfx
 {
@@ -57,6 +58,50 @@ namespace Egfx
 		{
 			static constexpr uint8_t Rgb565 = 0x55;
 		}
+
+		namespace Init
+		{
+			static constexpr uint8_t Sequence[] PROGMEM
+			{
+				InitSequence::Reset, InitSequence::PeriodHigh(RESET_DELAY_MICROS), InitSequence::PeriodLow(RESET_DELAY_MICROS),
+				0, (uint8_t)CommandEnum::SoftwareReset,
+				InitSequence::Delay, InitSequence::PeriodHigh(RESET_WAIT_MICROS), InitSequence::PeriodLow(RESET_WAIT_MICROS),
+				0, (uint8_t)CommandEnum::SleepOut,
+				InitSequence::Delay, InitSequence::PeriodHigh(SLEEP_EXIT_DELAY_MICROS), InitSequence::PeriodLow(SLEEP_EXIT_DELAY_MICROS),
+
+				// Pixel format: RGB565
+				1, (uint8_t)CommandEnum::SetPixelFormat, PixelFormats::Rgb565,
+
+				// MADCTL: no rotation, no mirroring, BGR order
+				1, (uint8_t)CommandEnum::SetMemoryAccessControl, 0x08,
+
+				5, (uint8_t)CommandEnum::PorchSetting, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+				1, (uint8_t)CommandEnum::GateControl, 0x35,
+				1, (uint8_t)CommandEnum::VCOMSSetting, 0x28,
+				1, (uint8_t)CommandEnum::LCMControl, 0x0C,
+				1, (uint8_t)CommandEnum::VDVVRHEN, 0x01,
+				1, (uint8_t)CommandEnum::VRHSet, 0x10,
+				1, (uint8_t)CommandEnum::VDVSet, 0x20,
+				1, (uint8_t)CommandEnum::FrameRateControl, 0x0F,
+				2, (uint8_t)CommandEnum::PowerControl1, 0xA4, 0xA1,
+
+				// Gamma (JLX240)
+				14, (uint8_t)CommandEnum::PositiveGamma,
+				0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32, 0x44,
+				0x42, 0x06, 0x0E, 0x12, 0x14, 0x17,
+				14, (uint8_t)CommandEnum::NegativeGamma,
+				0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31, 0x54,
+				0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E,
+
+				InitSequence::Commands + 2,
+				(uint8_t)CommandEnum::InversionOn,
+				(uint8_t)CommandEnum::NormalDisplayOn,
+				InitSequence::Delay, InitSequence::PeriodHigh(DISPLAY_ON_DELAY_MICROS), InitSequence::PeriodLow(DISPLAY_ON_DELAY_MICROS),
+				0, (uint8_t)CommandEnum::DisplayOn,
+				InitSequence::Delay, InitSequence::PeriodHigh(DISPLAY_ON_DELAY_MICROS), InitSequence::PeriodLow(DISPLAY_ON_DELAY_MICROS),
+				InitSequence::End
+			};
+		}
 	}
 }
 
@@ -34,9 +34,7 @@ namespace Egfx
 	protected:
 		using BaseClass::CommandEnd;
 		using BaseClass::CommandStart;
-		using BaseClass::PinReset;
 		using BaseClass::SpiInstance;
-		using BaseClass::SpiTransfer;
 
 	private:
 		SPISettings Settings;
@@ -57,16 +55,16 @@ namespace Egfx
 				return false;
 			}
 
-			PinReset(GC9107::RESET_DELAY_MICROS);
+			BaseClass::StartInitSequence(GetInitSequence(), Settings);
 
-			return Initialize();
+			return true;
 		}
 
 		void StartBuffer() override
 		{
 			CommandStart(Settings);
 			SpiInstance.transfer((uint8_t)GC9107::CommandEnum::MemoryWrite);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 		}
 
 		void EndBuffer() override
@@ -75,115 +73,35 @@ namespace Egfx
 			BaseClass::EndBuffer();
 		}
 
-	protected:
-		virtual uint8_t GetMemoryAccessControlValue() const
-		{
-			// Align expected color order (BGR) with framebuffer color order (RGB).
-			return GC9107::MemoryAccessControl::ColorOrderBgr;
-		}
-
-		virtual uint8_t GetPixelFormatValue() const
-		{
-			return GC9107::PixelFormats::Rgb565;
-		}
-
 	private:
-		bool Initialize()
-		{
-			SoftwareResetAndWake();
-
-			SendCommand(GC9107::CommandEnum::SetPixelFormat, GetPixelFormatValue());
-			SendCommand(GC9107::CommandEnum::SetMemoryAccessControl, GetMemoryAccessControlValue());
-
-			ConfigureAddressWindow();
-
-			SendCommand(GC9107::CommandEnum::InversionOn);
-			SendCommand(GC9107::CommandEnum::IdleOff);
-			SendCommand(GC9107::CommandEnum::DisplayOn);
-			DelayMicros(GC9107::DISPLAY_ON_DELAY_MICROS);
-
-			return true;
-		}
-
-		void SoftwareResetAndWake()
-		{
-			SendCommand(GC9107::CommandEnum::SoftwareReset);
-			DelayMicros(GC9107::SOFTWARE_RESET_DELAY_MICROS);
-
-			SendCommand(GC9107::CommandEnum::SleepOut);
-			DelayMicros(GC9107::SLEEP_EXIT_DELAY_MICROS);
-		}
-
-		void ConfigureAddressWindow()
+		static const uint8_t* GetInitSequence()
 		{
-			const uint16_t columnStart = offsetX;
-			const uint16_t columnEnd = static_cast<uint16_t>(offsetX + (uint16_t)width - 1);
-			const uint8_t columnData[]
-			{
-				static_cast<uint8_t>(columnStart >> 8),
-				static_cast<uint8_t>(columnStart & UINT8_MAX),
-				static_cast<uint8_t>(columnEnd >> 8),
-				static_cast<uint8_t>(columnEnd & UINT8_MAX)
-			};
-			SendCommand(GC9107::CommandEnum::SetColumnAddress, columnData, sizeof(columnData));
+			static constexpr uint16_t columnEnd = offsetX + (uint16_t)width - 1;
+			static constexpr uint16_t rowEnd = offsetY + (uint16_t)height - 1;
 
-			const uint16_t rowStart = offsetY;
-			const uint16_t rowEnd = static_cast<uint16_t>(offsetY + (uint16_t)height - 1);
-			const uint8_t rowData[]
+			static constexpr uint8_t sequence[] PROGMEM
 			{
-				static_cast<uint8_t>(rowStart >> 8),
-				static_cast<uint8_t>(rowStart & UINT8_MAX),
-				static_cast<uint8_t>(rowEnd >> 8),
-				static_cast<uint8_t>(rowEnd & UINT8_MAX)
+				InitSequence::Reset, InitSequence::PeriodHigh(GC9107::RESET_DELAY_MICROS), InitSequence::PeriodLow(GC9107::RESET_DELAY_MICROS),
+				0, (uint8_t)GC9107::CommandEnum::SoftwareReset,
+				InitSequence::Delay, InitSequence::PeriodHigh(GC9107::SOFTWARE_RESET_DELAY_MICROS), InitSequence::PeriodLow(GC9107::SOFTWARE_RESET_DELAY_MICROS),
+				0, (uint8_t)GC9107::CommandEnum::SleepOut,
+				InitSequence::Delay, InitSequence::PeriodHigh(GC9107::SLEEP_EXIT_DELAY_MICROS), InitSequence::PeriodLow(GC9107::SLEEP_EXIT_DELAY_MICROS),
+				1, (uint8_t)GC9107::CommandEnum::SetPixelFormat, GC9107::PixelFormats::Rgb565,
+				// Align expected color order (BGR) with framebuffer color order (RGB).
+				1, (uint8_t)GC9107::CommandEnum::SetMemoryAccessControl, GC9107::MemoryAccessControl::ColorOrderBgr,
+				4, (uint8_t)GC9107::CommandEnum::SetColumnAddress,
+				InitSequence::High(offsetX), InitSequence::Low(offsetX), InitSequence::High(columnEnd), InitSequence::Low(columnEnd),
+				4, (uint8_t)GC9107::CommandEnum::SetRowAddress,
+				InitSequence::High(offsetY), InitSequence::Low(offsetY), InitSequence::High(rowEnd), InitSequence::Low(rowEnd),
+				InitSequence::Commands + 3,
+				(uint8_t)GC9107::CommandEnum::InversionOn,
+				(uint8_t)GC9107::CommandEnum::IdleOff,
+				(uint8_t)GC9107::CommandEnum::DisplayOn,
+				InitSequence::Delay, InitSequence::PeriodHigh(GC9107::DISPLAY_ON_DELAY_MICROS), InitSequence::PeriodLow(GC9107::DISPLAY_ON_DELAY_MICROS),
+				InitSequence::End
 			};
-			SendCommand(GC9107::CommandEnum::SetRowAddress, rowData, sizeof(rowData));
-		}
 
-		void SendCommand(const GC9107::CommandEnum command)
-		{
-			SendCommand(command, nullptr, 0);
-		}
-
-		void SendCommand(const GC9107::CommandEnum command, const uint8_t value)
-		{
-			const uint8_t payload[]{ value };
-			SendCommand(command, payload, sizeof(payload));
-		}
-
-		void SendCommand(const GC9107::CommandEnum command, const uint8_t* data, const size_t length)
-		{
-			CommandStart(Settings);
-			SpiInstance.transfer(static_cast<uint8_t>(command));
-
-			if (length > 0 && data != nullptr)
-			{
-				digitalWrite(pinDC, HIGH);
-				SpiTransfer(data, length);
-				digitalWrite(pinDC, LOW);
-			}
-
-			CommandEnd();
-		}
-
-		static void DelayMicros(const uint32_t micros)
-		{
-			if (micros == 0)
-			{
-				return;
-			}
-
-			const uint32_t milliseconds = micros / 1000UL;
-			const uint32_t remainder = micros % 1000UL;
-
-			if (milliseconds > 0)
-			{
-				delay(milliseconds);
-			}
-
-			if (remainder > 0)
-			{
-				delayMicroseconds(remainder);
-			}
+			return sequence;
 		}
 	};
 
@@ -216,7 +134,7 @@ namespace Egfx
 		const uint32_t spiSpeed = GC9107::SpiDefaultSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -35,9 +35,9 @@ namespace Egfx
 			if (!BaseClass::Start())
 				return false;
 
-			BaseClass::PinReset(GC9A01::RESET_DELAY_MICROS);
+			BaseClass::StartInitSequence(GC9A01::Init::Sequence, Settings);
 
-			return Initialize();
+			return true;
 		}
 
 		void StartBuffer() override
@@ -46,7 +46,7 @@ namespace Egfx
 
 			BaseClass::CommandStart(Settings);
 			BaseClass::SpiInstance.transfer((uint8_t)GC9A01::CommandEnum::MemoryWrite);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 		}
 
 		void EndBuffer() override
@@ -56,43 +56,6 @@ namespace Egfx
 		}
 
 	private:
-		bool Initialize()
-		{
-			SendRaw(GC9A01::CommandEnum::SoftwareReset);
-			DelayMicros(20000);
-			SendRaw(GC9A01::CommandEnum::SleepOut);
-			DelayMicros(GC9A01::SLEEP_EXIT_DELAY_MICROS);
-
-			SendInit(GC9A01::Init::Sequence, sizeof(GC9A01::Init::Sequence) / sizeof(GC9A01::Init::Sequence[0]));
-
-			{
-				const uint8_t d = 0x08;
-				SendRaw(GC9A01::CommandEnum::MemoryAccessCtrl, &d, 1);
-			}
-			{
-				const uint8_t d = GC9A01::PixelFormats::Rgb565;
-				SendRaw(GC9A01::CommandEnum::PixelFormatSet, &d, 1);
-			}
-
-			SetAddressWindow(0, 0, GC9A01::Width - 1, GC9A01::Height - 1);
-
-			SendRaw((uint8_t)0x21);
-			SendRaw(GC9A01::CommandEnum::NormalDisplayOn);
-			DelayMicros(GC9A01::DISPLAY_ON_DELAY_MICROS);
-			SendRaw(GC9A01::CommandEnum::DisplayOn);
-			DelayMicros(GC9A01::DISPLAY_ON_DELAY_MICROS);
-
-			return true;
-		}
-
-		void SendInit(const GC9A01::Init::RawCommand* seq, const size_t count)
-		{
-			for (size_t i = 0; i < count; i++)
-			{
-				SendRaw(seq[i].Command, seq[i].Data, seq[i].Length);
-			}
-		}
-
 		void SendRaw(const GC9A01::CommandEnum cmd, const uint8_t* data = nullptr, const size_t len = 0)
 		{
 			SendRaw((uint8_t)cmd, data, len);
@@ -105,9 +68,9 @@ namespace Egfx
 
 			if (len && data)
 			{
-				digitalWrite(pinDC, HIGH);
+				GpioPin<pinDC>::High();
 				BaseClass::SpiTransfer(data, len);
-				digitalWrite(pinDC, LOW);
+				GpioPin<pinDC>::Low();
 			}
 
 			BaseClass::CommandEnd();
@@ -127,13 +90,6 @@ namespace Egfx
 			};
 			SendRaw((uint8_t)GC9A01::CommandEnum::RowAddressSet, raset, sizeof(raset));
 		}
-
-		static void DelayMicros(const uint32_t us)
-		{
-			if (!us) return;
-			delay(us / 1000);
-			delayMicroseconds(us % 1000);
-		}
 	};
 
 	template<const uint8_t pinCS = UINT8_MAX,
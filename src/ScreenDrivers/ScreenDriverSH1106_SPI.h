@@ -38,7 +38,6 @@ namespace Egfx
 		using BaseClass::SpiTransfer;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::PinReset;
 
 	protected:
 		SPISettings Settings;
@@ -67,7 +66,7 @@ namespace Egfx
 				SpiInstance.transfer(PushPage1);
 				SpiInstance.transfer(PushPage2);
 
-				digitalWrite(pinDC, HIGH);
+				GpioPin<pinDC>::High();
 				SpiTransfer(&frameBuffer[(uint_least16_t)p * PageChunkSize], PageChunkSize);
 				CommandEnd();
 			}
@@ -78,19 +77,7 @@ namespace Egfx
 	protected:
 		bool Initialize()
 		{
-			PinReset(SH1106::RESET_WAIT_MICROS);
-			delayMicroseconds(SH1106::RESET_DELAY_MICROS);
-
-			CommandStart(Settings);
-			SpiTransfer(SH1106::ConfigBatch, sizeof(SH1106::ConfigBatch));
-			CommandEnd();
-
-			delayMicroseconds(SH1106::BOOT_DELAY_MICROS);
-
-			CommandStart(Settings);
-			SpiInstance.transfer((uint8_t)SH1106::CommandEnum::CommandStart);
-			SpiInstance.transfer((uint8_t)SH1106::CommandEnum::DisplayOn);
-			CommandEnd();
+			BaseClass::StartInitSequence(SH1106::Init::Sequence, Settings);
 
 			return true;
 		}
@@ -192,7 +179,7 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)SH1106_128x64::CommandEnum::PushPage1);
 			SpiInstance.transfer((uint8_t)SH1106_128x64::CommandEnum::PushPage2);
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 			SpiTransfer(&frameBuffer[0], SH1106_128x64::PageChunkSize);
 			CommandEnd();
 			PushIndex++;
@@ -207,7 +194,7 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)SH1106_128x64::CommandEnum::PushPage1);
 			SpiInstance.transfer((uint8_t)SH1106_128x64::CommandEnum::PushPage2);
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 			SpiTransfer(&frameBuffer[(uint_least16_t)PushIndex * SH1106_128x64::PageChunkSize], SH1106_128x64::PageChunkSize);
 			CommandEnd();
 			PushIndex++;
@@ -250,7 +237,7 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)SH1106_132x64::CommandEnum::PushPage1);
 			SpiInstance.transfer((uint8_t)SH1106_132x64::CommandEnum::PushPage2);
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 			SpiTransfer(&frameBuffer[0], SH1106_132x64::PageChunkSize);
 			CommandEnd();
 			PushIndex++;
@@ -265,7 +252,7 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)SH1106_132x64::CommandEnum::PushPage1);
 			SpiInstance.transfer((uint8_t)SH1106_132x64::CommandEnum::PushPage2);
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 			SpiTransfer(&frameBuffer[(uint_least16_t)PushIndex * SH1106_132x64::PageChunkSize], SH1106_132x64::PageChunkSize);
 			CommandEnd();
 			PushIndex++;
@@ -369,7 +356,7 @@ namespace Egfx
 			SpiInstance.transfer(PushPage1);
 			SpiInstance.transfer(PushPage2);
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 
 			const uint8_t* pagePtr = &FrameBuffer[(uint_least16_t)page * PageChunkSize];
 
@@ -427,7 +414,7 @@ namespace Egfx
 		const uint32_t spiSpeed = SH1106::SpiMaxSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -444,7 +431,7 @@ namespace Egfx
 		const uint32_t spiSpeed = SH1106::SpiMaxSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
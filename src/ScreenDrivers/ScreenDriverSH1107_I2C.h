@@ -37,7 +37,7 @@ namespace Egfx
 		static constexpr size_t REMAINDER_START = (size_t)BUFFER_WHOLE * I2C_BUFFER_SIZE;
 
 	public:
-		AbstractScreenDriverSH1107_I2C(TwoWire& wire)
+		AbstractScreenDriverSH1107_I2C(Egfx::WireType& wire)
 			: BaseClass(wire)
 		{
 		}
@@ -49,16 +49,6 @@ namespace Egfx
 			return BaseClass::Start();
 		}
 
-		void Stop() override
-		{
-			WireInstance.end();
-		}
-
-		bool CanPushBuffer() override
-		{
-			return true;
-		}
-
 		void StartBuffer() override
 		{
 		}
@@ -100,17 +90,9 @@ namespace Egfx
 		}
 
 	protected:
-		// Note: SH1107 init varies by module. This just sends SH1107::ConfigBatch.
 		bool Initialize()
 		{
-			delayMicroseconds(SH1107::RESET_DELAY_MICROS);
-
-			CommandStart();
-			WireInstance.write((uint8_t)SH1107::CommandEnum::CommandStart); // 0x00 control-byte for commands
-			WireInstance.write(SH1107::ConfigBatch, sizeof(SH1107::ConfigBatch));
-			CommandEnd();
-
-			delayMicroseconds(SH1107::BOOT_DELAY_MICROS);
+			BaseClass::StartInitSequence(SH1107::Init::Sequence);
 
 			return true;
 		}
@@ -159,7 +141,7 @@ namespace Egfx
 		using BaseClass = AbstractScreenDriverSH1107_I2C<SH1107::Width, SH1107::Height, SH1107::I2CAddress>;
 
 	public:
-		ScreenDriverSH1107_128x128x1_I2C(TwoWire& wire)
+		ScreenDriverSH1107_128x128x1_I2C(Egfx::WireType& wire)
 			: BaseClass(wire)
 		{
 		}
@@ -179,9 +161,9 @@ namespace Egfx
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS)
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
+		UBaseType_t priority = 1>
 	using ScreenDriverSH1107_128x128x1_I2C_Rtos =
-		TemplateScreenDriverRtos<TwoWire, ScreenDriverSH1107_128x128x1_I2C, pushSleepDuration, stackHeight, priority>;
+		TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSH1107_128x128x1_I2C, pushSleepDuration, stackHeight, priority>;
 #endif
 
 #if defined(TEMPLATE_SCREEN_DRIVER_I2C_DMA)
@@ -5,7 +5,7 @@
 #include "TemplateScreenDriverRtos.h"
 #include "TemplateScreenDriverI2CDma.h"
 #include "TemplateScreenDriverI2CAsync.h"
-#include "SSD1306\SSD1306.h"
+#include "SSD1306/SSD1306.h"
 
 namespace Egfx
 {
@@ -49,7 +49,7 @@ namespace Egfx
 #endif
 
 	public:
-		AbstractScreenDriverSSD1306_I2C(TwoWire& wire) : BaseClass(wire)
+		AbstractScreenDriverSSD1306_I2C(Egfx::WireType& wire) : BaseClass(wire)
 		{
 		}
 
@@ -80,12 +80,7 @@ namespace Egfx
 		virtual void Stop()
 		{
 			CommandReset();
-			WireInstance.end();
-		}
-
-		virtual bool CanPushBuffer()
-		{
-			return true;
+			BaseClass::Stop();
 		}
 
 		virtual void StartBuffer()
@@ -121,21 +116,7 @@ namespace Egfx
 		bool Initialize()
 		{
 			CommandReset();
-			delayMicroseconds(SSD1306::RESET_DELAY_MICROS);
-
-			// Send the default batch as-is.
-			CommandStart();
-			WireInstance.write(SSD1306::ConfigBatch, sizeof(SSD1306::ConfigBatch));
-			CommandEnd();
-
-			// Override the height-dependent settings (multiplex ratio and COM pins).
-			CommandStart();
-			WireInstance.write((uint8_t)SSD1306::CommandEnum::CommandStart);
-			WireInstance.write((uint8_t)SSD1306::CommandEnum::SetMultiplexRatio);
-			WireInstance.write(ScreenHeight - 1);
-			WireInstance.write((uint8_t)SSD1306::CommandEnum::SetComPins);
-			WireInstance.write(comPins);
-			CommandEnd();
+			BaseClass::StartInitSequence(SSD1306::Init::Sequence<height, comPins>::Data);
 
 			return true;
 		}
@@ -217,7 +198,7 @@ namespace Egfx
 			SSD1306::I2CAddress>;
 
 	public:
-		ScreenDriverSSD1306_64x32x1_I2C(TwoWire& wire) : BaseClass(wire) {}
+		ScreenDriverSSD1306_64x32x1_I2C(Egfx::WireType& wire) : BaseClass(wire) {}
 		
 		~ScreenDriverSSD1306_64x32x1_I2C() override = default;
 
@@ -246,7 +227,7 @@ namespace Egfx
 			SSD1306::I2CAddress>;
 
 	public:
-		ScreenDriverSSD1306_64x48x1_I2C(TwoWire& wire) : BaseClass(wire) {}
+		ScreenDriverSSD1306_64x48x1_I2C(Egfx::WireType& wire) : BaseClass(wire) {}
 
 		~ScreenDriverSSD1306_64x48x1_I2C() override = default;
 
@@ -275,7 +256,7 @@ namespace Egfx
 			SSD1306::I2CAddress>;
 
 	public:
-		ScreenDriverSSD1306_72x40x1_I2C(TwoWire& wire) : BaseClass(wire) {}
+		ScreenDriverSSD1306_72x40x1_I2C(Egfx::WireType& wire) : BaseClass(wire) {}
 
 		~ScreenDriverSSD1306_72x40x1_I2C() override = default;
 
@@ -304,7 +285,7 @@ namespace Egfx
 			SSD1306::I2CAddress>;
 
 	public:
-		ScreenDriverSSD1306_128x32x1_I2C(TwoWire& wire) : BaseClass(wire) {}
+		ScreenDriverSSD1306_128x32x1_I2C(Egfx::WireType& wire) : BaseClass(wire) {}
 
 		~ScreenDriverSSD1306_128x32x1_I2C() override = default;
 
@@ -333,7 +314,7 @@ namespace Egfx
 			SSD1306::I2CAddress>;
 
 	public:
-		ScreenDriverSSD1306_128x64x1_I2C(TwoWire& wire) : BaseClass(wire) {}
+		ScreenDriverSSD1306_128x64x1_I2C(Egfx::WireType& wire) : BaseClass(wire) {}
 
 		~ScreenDriverSSD1306_128x64x1_I2C() override = default;
 
@@ -361,28 +342,28 @@ namespace Egfx
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS)
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
-	using ScreenDriverSSD1306_64x32x1_I2C_Rtos = TemplateScreenDriverRtos<TwoWire, ScreenDriverSSD1306_64x32x1_I2C, pushSleepDuration, stackHeight, priority>;
+		UBaseType_t priority = 1>
+	using ScreenDriverSSD1306_64x32x1_I2C_Rtos = TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSSD1306_64x32x1_I2C, pushSleepDuration, stackHeight, priority>;
 
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
-	using ScreenDriverSSD1306_64x48x1_I2C_Rtos = TemplateScreenDriverRtos<TwoWire, ScreenDriverSSD1306_64x48x1_I2C, pushSleepDuration, stackHeight, priority>;
+		UBaseType_t priority = 1>
+	using ScreenDriverSSD1306_64x48x1_I2C_Rtos = TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSSD1306_64x48x1_I2C, pushSleepDuration, stackHeight, priority>;
 
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
-	using ScreenDriverSSD1306_72x40x1_I2C_Rtos = TemplateScreenDriverRtos<TwoWire, ScreenDriverSSD1306_72x40x1_I2C, pushSleepDuration, stackHeight, priority>;
+		UBaseType_t priority = 1>
+	using ScreenDriverSSD1306_72x40x1_I2C_Rtos = TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSSD1306_72x40x1_I2C, pushSleepDuration, stackHeight, priority>;
 
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
-	using ScreenDriverSSD1306_128x32x1_I2C_Rtos = TemplateScreenDriverRtos<TwoWire, ScreenDriverSSD1306_128x32x1_I2C, pushSleepDuration, stackHeight, priority>;
+		UBaseType_t priority = 1>
+	using ScreenDriverSSD1306_128x32x1_I2C_Rtos = TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSSD1306_128x32x1_I2C, pushSleepDuration, stackHeight, priority>;
 
 	template<const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1>
-	using ScreenDriverSSD1306_128x64x1_I2C_Rtos = TemplateScreenDriverRtos<TwoWire, ScreenDriverSSD1306_128x64x1_I2C, pushSleepDuration, stackHeight, priority>;
+		UBaseType_t priority = 1>
+	using ScreenDriverSSD1306_128x64x1_I2C_Rtos = TemplateScreenDriverRtos<Egfx::WireType, ScreenDriverSSD1306_128x64x1_I2C, pushSleepDuration, stackHeight, priority>;
 #endif
 
 #if defined(TEMPLATE_SCREEN_DRIVER_I2C_DMA)
@@ -5,7 +5,7 @@
 #include "TemplateScreenDriverRtos.h"
 #include "TemplateScreenDriverSpiAsync.h"
 #include "TemplateScreenDriverSpiDma.h"
-#include "SSD1306\SSD1306.h"
+#include "SSD1306/SSD1306.h"
 
 namespace Egfx
 {
@@ -30,8 +30,6 @@ namespace Egfx
 		using BaseClass::SpiInstance;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::SpiTransfer;
-		using BaseClass::PinReset;
 
 	private:
 		SPISettings Settings;
@@ -59,31 +57,13 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)0);
 			SpiInstance.transfer((uint8_t)((ScreenHeight / 8) - 1));
 
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 		}
 
 	protected:
 		bool Initialize()
 		{
-			PinReset(SSD1306::RESET_WAIT_MICROS);
-			delayMicroseconds(SSD1306::RESET_DELAY_MICROS);
-
-			// Base init batch
-			CommandStart(Settings);
-			SpiTransfer(SSD1306::ConfigBatch, sizeof(SSD1306::ConfigBatch));
-			CommandEnd();
-
-			// Per-variant overrides to match I2C driver behavior
-			CommandStart(Settings);
-			SpiInstance.transfer((uint8_t)SSD1306::CommandEnum::CommandStart);
-
-			SpiInstance.transfer((uint8_t)SSD1306::CommandEnum::SetMultiplexRatio);
-			SpiInstance.transfer((uint8_t)(ScreenHeight - 1));
-
-			SpiInstance.transfer((uint8_t)SSD1306::CommandEnum::SetComPins);
-			SpiInstance.transfer((uint8_t)comPins);
-
-			CommandEnd();
+			BaseClass::StartInitSequence(SSD1306::Init::Sequence<uint8_t(height), comPins>::Data, Settings);
 
 			return true;
 		}
@@ -152,7 +132,7 @@ namespace Egfx
 		const uint32_t spiSpeed = SSD1306::SpiMaxSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
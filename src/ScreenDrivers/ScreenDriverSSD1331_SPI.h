@@ -2,10 +2,13 @@
 #define _SCREEN_DRIVER_SSD1331_SPI_h
 
 #include "AbstractScreenDriverSPI.h"
+#include "../Model/DisplayOptions.h"
 #include "TemplateScreenDriverRtos.h"
 #include "TemplateScreenDriverSpiAsync.h"
 #include "TemplateScreenDriverSpiDma.h"
+#include "TemplateScreenDriverRowHash.h"
 #include "SSD1331/SSD1331.h"
+#include "../DisplayEngine/SharedBusArbiter.h"
 
 namespace Egfx
 {
@@ -24,16 +27,28 @@ namespace Egfx
 		using BaseClass::ScreenHeight;
 		using BaseClass::BufferSize;
 
+		/// <summary>
+		/// The controller only scrolls the whole screen, row scroll regions are not supported.
+		/// </summary>
+		static constexpr bool HardwareScroll = false;
+
+	private:
+		static constexpr uint8_t RgbMode = sizeof(pixel_color_t) == sizeof(uint16_t) ? SSD1331::MapRgb565 : SSD1331::MapRgb332;
+
 	protected:
 		using BaseClass::SpiInstance;
 		using BaseClass::SpiTransfer;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::PinReset;
 
 	protected:
 		SPISettings Settings;
 
+	private:
+		uint32_t GraphicStart = 0;
+		uint16_t GraphicDuration = 0;
+		bool BufferPushing = false;
+
 	public:
 		AbstractScreenDriverSSD1331_SPI(Egfx::SpiType& spi)
 			: BaseClass(spi)
@@ -44,27 +59,147 @@ namespace Egfx
 		~AbstractScreenDriverSSD1331_SPI() override = default;
 
 	public:
+		virtual bool CanPushBuffer()
+		{
+			return !GraphicBusy() && BaseClass::CanPushBuffer();
+		}
+
 		virtual void StartBuffer()
 		{
+			BufferPushing = true;
 			CommandStart(Settings);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
+		}
+
+		virtual void EndBuffer()
+		{
+			BaseClass::EndBuffer();
+			BufferPushing = false;
+		}
+
+	public:
+		/// <summary>
+		/// Hardware graphic commands can be issued: no buffer push in progress and the last command has completed.
+		/// Each command is its own SPI transaction: on a shared bus, hold the bus around it (see TemplateSSD1331Accelerator).
+		/// </summary>
+		bool CanAccelerate()
+		{
+			return !BufferPushing && !GraphicBusy();
+		}
+
+		/// <summary>
+		/// Hardware line, drawn by the controller directly in display RAM.
+		/// </summary>
+		void AcceleratedLine(const rgb_color_t color, const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2)
+		{
+			uint8_t command[]{
+				(uint8_t)SSD1331::CommandEnum::DrawLine, x1, y1, x2, y2,
+				GetColorC(color), GetColorB(color), GetColorA(color) };
+
+			GraphicCommand(command, sizeof(command), SSD1331::DRAW_LINE_MICROS);
+		}
+
+		/// <summary>
+		/// Hardware filled rectangle, drawn by the controller directly in display RAM.
+		/// </summary>
+		void AcceleratedRectangleFill(const rgb_color_t color, const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2)
+		{
+			const uint8_t c = GetColorC(color);
+			const uint8_t b = GetColorB(color);
+			const uint8_t a = GetColorA(color);
+			uint8_t command[]{
+				(uint8_t)SSD1331::CommandEnum::DrawRectangle, x1, y1, x2, y2,
+				c, b, a,
+				c, b, a };
+
+			GraphicCommand(command, sizeof(command), SSD1331::DRAW_RECTANGLE_MICROS);
+		}
+
+		/// <summary>
+		/// Hardware copy of a window to a new top-left position, done by the controller in display RAM.
+		/// </summary>
+		void AcceleratedCopy(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2, const uint8_t toX, const uint8_t toY)
+		{
+			uint8_t command[]{
+				(uint8_t)SSD1331::CommandEnum::Copy, x1, y1, x2, y2, toX, toY };
+
+			GraphicCommand(command, sizeof(command), SSD1331::COPY_MICROS);
+		}
+
+		/// <summary>
+		/// Hardware clear (to black) of a window, done by the controller in display RAM.
+		/// </summary>
+		void AcceleratedClear(const uint8_t x1, const uint8_t y1, const uint8_t x2, const uint8_t y2)
+		{
+			uint8_t command[]{
+				(uint8_t)SSD1331::CommandEnum::ClearWindow, x1, y1, x2, y2 };
+
+			GraphicCommand(command, sizeof(command), SSD1331::CLEAR_WINDOW_MICROS);
 		}
 
 	protected:
-		bool Initialize(const uint8_t rgbMode)
+		/// <summary>
+		/// Restricts the RAM write to the given rows and restarts it.
+		/// Must be called inside an open buffer transaction.
+		/// </summary>
+		void SetRowWindow(const pixel_t startRow, const pixel_t endRow)
 		{
-			PinReset(SSD1331::RESET_WAIT_MICROS);
-			delayMicroseconds(SSD1331::RESET_DELAY_MICROS);
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)SSD1331::CommandEnum::SetColumnAddress);
+			SpiInstance.transfer((uint8_t)0);
+			SpiInstance.transfer((uint8_t)(SSD1331::Width - 1));
+			SpiInstance.transfer((uint8_t)SSD1331::CommandEnum::SetRowAddress);
+			SpiInstance.transfer((uint8_t)startRow);
+			SpiInstance.transfer((uint8_t)endRow);
+			GpioPin<pinDC>::High();
+		}
 
-			CommandStart(Settings);
-			SpiInstance.transfer((uint8_t)SSD1331::CommandEnum::DisplayOff);
-			SpiInstance.transfer((uint8_t)SSD1331::CommandEnum::RemapAndColor);
-			SpiInstance.transfer(rgbMode);
+	private:
+		bool GraphicBusy()
+		{
+			if (GraphicDuration > 0)
+			{
+				if ((micros() - GraphicStart) < GraphicDuration)
+				{
+					return true;
+				}
+				GraphicDuration = 0;
+			}
+
+			return false;
+		}
 
-			SpiTransfer(SSD1331::CommonConfigBatch, sizeof(SSD1331::CommonConfigBatch));
-			SpiInstance.transfer((uint8_t)SSD1331::CommandEnum::DisplayOn);
+		void GraphicCommand(const uint8_t* command, const size_t size, const uint16_t duration)
+		{
+			CommandStart(Settings);
+			SpiTransfer(command, size);
 			CommandEnd();
 
+			GraphicStart = micros();
+			GraphicDuration = duration;
+		}
+
+		// Graphic commands take 6 bit color channels in both color modes, with C-B-A as R-G-B.
+		static constexpr uint8_t GetColorC(const rgb_color_t color)
+		{
+			return Rgb::R(color) >> 2;
+		}
+
+		static constexpr uint8_t GetColorB(const rgb_color_t color)
+		{
+			return Rgb::G(color) >> 2;
+		}
+
+		static constexpr uint8_t GetColorA(const rgb_color_t color)
+		{
+			return Rgb::B(color) >> 2;
+		}
+
+	protected:
+		bool Initialize()
+		{
+			BaseClass::StartInitSequence(SSD1331::Init::Sequence<RgbMode>::Data, Settings);
+
 			return true;
 		}
 	};
@@ -85,7 +220,7 @@ namespace Egfx
 
 		virtual bool Start()
 		{
-			return BaseClass::Start() && BaseClass::Initialize(SSD1331::MapRgb332);
+			return BaseClass::Start() && BaseClass::Initialize();
 		}
 	};
 
@@ -104,7 +239,238 @@ namespace Egfx
 
 		virtual bool Start()
 		{
-			return BaseClass::Start() && BaseClass::Initialize(SSD1331::MapRgb565);
+			return BaseClass::Start() && BaseClass::Initialize();
+		}
+	};
+
+	/// <summary>
+	/// Immediate-mode SSD1331 acceleration, for a row hash screen driver and a display engine in retained mode.
+	/// The framebuffer is always updated. When the driver is available and the affected rows are unchanged since the last push,
+	/// the controller draws the same change into display RAM and the rows are marked as pushed, so the next push skips them.
+	/// Otherwise the change is carried by the next push, as with software drawing.
+	/// Diagonal lines are not offered, as the controller's rasterization is not guaranteed to match the framebuffer's.
+	/// On a shared bus (e.g. MultiDisplayEngine), set the bus arbiter: commands are only issued while the bus is idle,
+	/// never in the middle of another display's push.
+	/// </summary>
+	/// <typeparam name="FramebufferType">Framebuffer in the panel's native orientation, without color inversion.</typeparam>
+	/// <typeparam name="ScreenDriverType">SSD1331 row hash screen driver, e.g. ScreenDriverSSD1331_96x64x16_SPI_RowHash.</typeparam>
+	template<typename FramebufferType, typename ScreenDriverType>
+	class TemplateSSD1331Accelerator
+	{
+	private:
+		using Options = typename FramebufferType::Configuration;
+
+		static_assert(FramebufferType::BufferSize == ScreenDriverType::BufferSize, "Framebuffer and screen driver color mismatch.");
+		static_assert(Options::Rotation == DisplayOptions::RotationEnum::None
+			&& Options::Mirror == DisplayOptions::MirrorEnum::None
+			&& !Options::Inverted, "Framebuffer must match display RAM layout.");
+
+		static constexpr uint8_t Width = SSD1331::Width;
+		static constexpr uint8_t Height = SSD1331::Height;
+		static constexpr size_t PixelSize = FramebufferType::BufferSize / ((size_t)Width * Height);
+
+	private:
+		FramebufferType& Framebuffer;
+		ScreenDriverType& ScreenDriver;
+
+		// Optional shared bus, held for each command.
+		SharedBusArbiter* BusArbiter = nullptr;
+
+	public:
+		TemplateSSD1331Accelerator(FramebufferType& framebuffer, ScreenDriverType& screenDriver)
+			: Framebuffer(framebuffer)
+			, ScreenDriver(screenDriver)
+		{
+		}
+
+		/// <summary>
+		/// Sets the arbiter for a bus shared with other screen drivers, nullptr for a dedicated bus.
+		/// </summary>
+		void SetBusArbiter(SharedBusArbiter* busArbiter)
+		{
+			BusArbiter = busArbiter;
+		}
+
+		/// <returns>True if the panel was updated by the controller.</returns>
+		bool RectangleFill(const rgb_color_t color, const pixel_t x1, const pixel_t y1, const pixel_t x2, const pixel_t y2)
+		{
+			uint8_t left, top, right, bottom;
+			if (!ClipWindow(x1, y1, x2, y2, left, top, right, bottom))
+			{
+				return false;
+			}
+
+			const bool accelerate = CanAccelerate(top, bottom);
+
+			Framebuffer.RectangleFill(color, left, top, right, bottom);
+
+			if (accelerate)
+			{
+				ScreenDriver.AcceleratedRectangleFill(color, left, top, right, bottom);
+				EndAccelerate(top, bottom);
+			}
+
+			return accelerate;
+		}
+
+		/// <returns>True if the panel was updated by the controller.</returns>
+		bool LineHorizontal(const rgb_color_t color, const pixel_t x1, const pixel_t x2, const pixel_t y)
+		{
+			uint8_t left, top, right, bottom;
+			if (!ClipWindow(x1, y, x2, y, left, top, right, bottom))
+			{
+				return false;
+			}
+
+			const bool accelerate = CanAccelerate(top, top);
+
+			Framebuffer.LineHorizontal(color, left, right, top);
+
+			if (accelerate)
+			{
+				ScreenDriver.AcceleratedLine(color, left, top, right, top);
+				EndAccelerate(top, top);
+			}
+
+			return accelerate;
+		}
+
+		/// <returns>True if the panel was updated by the controller.</returns>
+		bool LineVertical(const rgb_color_t color, const pixel_t x, const pixel_t y1, const pixel_t y2)
+		{
+			uint8_t left, top, right, bottom;
+			if (!ClipWindow(x, y1, x, y2, left, top, right, bottom))
+			{
+				return false;
+			}
+
+			const bool accelerate = CanAccelerate(top, bottom);
+
+			Framebuffer.LineVertical(color, left, top, bottom);
+
+			if (accelerate)
+			{
+				ScreenDriver.AcceleratedLine(color, left, top, left, bottom);
+				EndAccelerate(top, bottom);
+			}
+
+			return accelerate;
+		}
+
+		/// <summary>
+		/// Clears a window to black. A full screen clear is a 5 byte command instead of a full push.
+		/// </summary>
+		/// <returns>True if the panel was updated by the controller.</returns>
+		bool Clear(const pixel_t x1, const pixel_t y1, const pixel_t x2, const pixel_t y2)
+		{
+			uint8_t left, top, right, bottom;
+			if (!ClipWindow(x1, y1, x2, y2, left, top, right, bottom))
+			{
+				return false;
+			}
+
+			const bool accelerate = CanAccelerate(top, bottom);
+
+			Framebuffer.RectangleFill(RGB_COLOR_BLACK, left, top, right, bottom);
+
+			if (accelerate)
+			{
+				ScreenDriver.AcceleratedClear(left, top, right, bottom);
+				EndAccelerate(top, bottom);
+			}
+
+			return accelerate;
+		}
+
+		/// <summary>
+		/// Copies a window to a new top-left position, e.g. to scroll a region.
+		/// The source window is left untouched where not overwritten.
+		/// </summary>
+		/// <returns>True if the panel was updated by the controller.</returns>
+		bool Copy(const pixel_t x1, const pixel_t y1, const pixel_t x2, const pixel_t y2, const pixel_t toX, const pixel_t toY)
+		{
+			uint8_t left, top, right, bottom;
+			if (!ClipWindow(x1, y1, x2, y2, left, top, right, bottom)
+				|| toX < 0 || toY < 0 || toX >= Width || toY >= Height)
+			{
+				return false;
+			}
+
+			// Clip the source so the destination fits the screen.
+			right = MinValue<uint8_t>(right, left + (Width - 1 - toX));
+			bottom = MinValue<uint8_t>(bottom, top + (Height - 1 - toY));
+
+			// Source rows must match display RAM too, as the controller copies from it.
+			const uint8_t toBottom = toY + (bottom - top);
+			const bool accelerate = CanAccelerate(MinValue<uint8_t>(top, toY), MaxValue<uint8_t>(bottom, toBottom));
+
+			CopyFramebuffer(left, top, right, bottom, toX, toY);
+
+			if (accelerate)
+			{
+				ScreenDriver.AcceleratedCopy(left, top, right, bottom, toX, toY);
+				EndAccelerate(toY, toBottom);
+			}
+
+			return accelerate;
+		}
+
+	private:
+		/// <summary>
+		/// The controller is free and display RAM holds the framebuffer's rows, so a hardware command keeps them in sync.
+		/// Takes the bus when shared, EndAccelerate() releases it.
+		/// </summary>
+		bool CanAccelerate(const uint8_t top, const uint8_t bottom)
+		{
+			return ScreenDriver.CanAccelerate()
+				&& ScreenDriver.RowsPushed(Framebuffer.GetFrameBuffer(), top, bottom)
+				&& (BusArbiter == nullptr || BusArbiter->TryAcquireIdle(this));
+		}
+
+		void EndAccelerate(const uint8_t top, const uint8_t bottom)
+		{
+			ScreenDriver.MarkRowsPushed(Framebuffer.GetFrameBuffer(), top, bottom);
+			if (BusArbiter != nullptr)
+			{
+				BusArbiter->Release(this);
+			}
+		}
+
+		void CopyFramebuffer(const uint8_t left, const uint8_t top, const uint8_t right, const uint8_t bottom, const uint8_t toX, const uint8_t toY)
+		{
+			uint8_t* buffer = Framebuffer.GetFrameBuffer();
+			const size_t rowSize = ((size_t)right - left + 1) * PixelSize;
+			const uint8_t rows = bottom - top + 1;
+
+			// Row order keeps overlapping source rows intact until copied.
+			for (uint8_t i = 0; i < rows; i++)
+			{
+				const uint8_t row = (toY > top) ? (rows - 1 - i) : i;
+				memmove(&buffer[(((size_t)(toY + row) * Width) + toX) * PixelSize],
+					&buffer[(((size_t)(top + row) * Width) + left) * PixelSize],
+					rowSize);
+			}
+		}
+
+		static bool ClipWindow(const pixel_t x1, const pixel_t y1, const pixel_t x2, const pixel_t y2,
+			uint8_t& left, uint8_t& top, uint8_t& right, uint8_t& bottom)
+		{
+			const pixel_t xStart = MaxValue<pixel_t>(0, MinValue(x1, x2));
+			const pixel_t xEnd = MinValue<pixel_t>(Width - 1, MaxValue(x1, x2));
+			const pixel_t yStart = MaxValue<pixel_t>(0, MinValue(y1, y2));
+			const pixel_t yEnd = MinValue<pixel_t>(Height - 1, MaxValue(y1, y2));
+
+			if (xStart > xEnd || yStart > yEnd)
+			{
+				return false;
+			}
+
+			left = (uint8_t)xStart;
+			top = (uint8_t)yStart;
+			right = (uint8_t)xEnd;
+			bottom = (uint8_t)yEnd;
+
+			return true;
 		}
 	};
 
@@ -122,6 +488,21 @@ namespace Egfx
 		const uint8_t spiChunkDivisor = 2>
 	using ScreenDriverSSD1331_96x64x16_SPI_Async = TemplateScreenDriverSpiAsync<ScreenDriverSSD1331_96x64x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
 
+	// Row hash variants, push only the changed row blocks. Required by TemplateSSD1331Accelerator.
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverSSD1331_96x64x8_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverSSD1331_96x64x8_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverSSD1331_96x64x16_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverSSD1331_96x64x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
 #if defined(TEMPLATE_SCREEN_DRIVER_SPI_DMA)
 	template<const uint8_t pinCS = UINT8_MAX,
 		const uint8_t pinDC = UINT8_MAX,
@@ -145,7 +526,7 @@ namespace Egfx
 		const uint32_t spiSpeed = 4000000,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -172,7 +553,7 @@ namespace Egfx
 		const uint32_t spiSpeed = 4000000,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -28,7 +28,6 @@ namespace Egfx
 		using BaseClass::SpiInstance;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::PinReset;
 
 	private:
 		SPISettings Settings;
@@ -45,7 +44,7 @@ namespace Egfx
 	public:
 		virtual void EndBuffer()
 		{
-			digitalWrite(pinDC, LOW);
+			GpioPin<pinDC>::Low();
 			SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::Nop1);
 			BaseClass::EndBuffer();
 		}
@@ -54,64 +53,7 @@ namespace Egfx
 		{
 			if (BaseClass::Start())
 			{
-				PinReset(SSD1351::RESET_WAIT_MICROS);
-				delayMicroseconds(SSD1351::RESET_DELAY_MICROS);
-
-				CommandStart(Settings);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::Unlock);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x12);
-				digitalWrite(pinDC, LOW);
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::Unlock);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0xB1);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetSleepOn);
-
-				ExecuteCommonBatch();
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetDisplayModeNormal);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetContrastA);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0xC8);
-				SpiInstance.transfer(0x80);
-				SpiInstance.transfer(0xC8);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetMasterCurrentAF);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x0F);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetSegmentLowVoltage);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0xA0);
-				SpiInstance.transfer(0xB5);
-				SpiInstance.transfer(0x55);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetPrechargeSpeed2);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x01);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetSleepOff);
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetDisplayModeNormal);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetColumnAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0);
-				SpiInstance.transfer(SSD1351::Width - 1);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::SetRowAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0);
-				SpiInstance.transfer(SSD1351::Height - 1);
-				CommandEnd();
+				BaseClass::StartInitSequence(SSD1351::Init::Sequence, Settings);
 
 				return true;
 			}
@@ -123,20 +65,7 @@ namespace Egfx
 		{
 			CommandStart(Settings);
 			SpiInstance.transfer((uint8_t)SSD1351::CommandEnum::WriteData);
-			digitalWrite(pinDC, HIGH);
-		}
-
-	private:
-		void ExecuteCommonBatch()
-		{
-			size_t index = 0;
-			while (index < sizeof(SSD1351::CommonCommandArgBatch))
-			{
-				SpiInstance.transfer(SSD1351::CommonCommandArgBatch[index++]);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(SSD1351::CommonCommandArgBatch[index++]);
-				digitalWrite(pinDC, LOW);
-			}
+			GpioPin<pinDC>::High();
 		}
 	};
 
@@ -169,7 +98,7 @@ namespace Egfx
 		const uint32_t spiSpeed = SSD1351::SpiMaxSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -5,6 +5,8 @@
 #include "TemplateScreenDriverRtos.h"
 #include "TemplateScreenDriverSpiAsync.h"
 #include "TemplateScreenDriverSpiDma.h"
+#include "TemplateScreenDriverRgb444Pack.h"
+#include "TemplateScreenDriverRowHash.h"
 #include "ST7735/ST7735.h"
 
 namespace Egfx
@@ -14,16 +16,17 @@ namespace Egfx
 		const uint8_t pinCS,
 		const uint8_t pinDC,
 		const uint8_t pinRST,
-		const uint32_t spiSpeed>
+		const uint32_t spiSpeed,
+		const uint8_t pushColorDepth = 16>
 	class AbstractScreenDriverST7735S_SPI : public AbstractScreenDriverSPI<
-		Egfx::GetFrameBufferSize<pixel_color_t>(panel_t::Width, panel_t::Height),
+		(pushColorDepth == 12) ? Egfx::GetFrameBufferColor12Size(panel_t::Width, panel_t::Height) : Egfx::GetFrameBufferSize<pixel_color_t>(panel_t::Width, panel_t::Height),
 		panel_t::Width,
 		panel_t::Height,
 		pinCS, pinDC, pinRST>
 	{
 	private:
 		using BaseClass = AbstractScreenDriverSPI<
-			Egfx::GetFrameBufferSize<pixel_color_t>(panel_t::Width, panel_t::Height),
+			(pushColorDepth == 12) ? Egfx::GetFrameBufferColor12Size(panel_t::Width, panel_t::Height) : Egfx::GetFrameBufferSize<pixel_color_t>(panel_t::Width, panel_t::Height),
 			panel_t::Width,
 			panel_t::Height,
 			pinCS, pinDC, pinRST>;
@@ -33,11 +36,15 @@ namespace Egfx
 		using BaseClass::ScreenHeight;
 		using BaseClass::BufferSize;
 
+		/// <summary>
+		/// The stock presets exchange rows and columns in MADCTL, so the controller's vertical scroll can't back row scrolling.
+		/// </summary>
+		static constexpr bool HardwareScroll = false;
+
 	protected:
 		using BaseClass::SpiInstance;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::PinReset;
 
 	private:
 		SPISettings Settings;
@@ -61,7 +68,7 @@ namespace Egfx
 
 				CommandStart(Settings);
 				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetColumnAddress);
-				digitalWrite(pinDC, HIGH);
+				GpioPin<pinDC>::High();
 				SpiInstance.transfer((uint8_t)(x0 >> 8));
 				SpiInstance.transfer((uint8_t)(x0 & 0xFF));
 				SpiInstance.transfer((uint8_t)(x1 >> 8));
@@ -70,7 +77,7 @@ namespace Egfx
 
 				CommandStart(Settings);
 				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetRowAddress);
-				digitalWrite(pinDC, HIGH);
+				GpioPin<pinDC>::High();
 				SpiInstance.transfer((uint8_t)(y0 >> 8));
 				SpiInstance.transfer((uint8_t)(y0 & 0xFF));
 				SpiInstance.transfer((uint8_t)(y1 >> 8));
@@ -88,194 +95,7 @@ namespace Egfx
 
 			if (BaseClass::Start())
 			{
-				PinReset(ST7735::RESET_DELAY_MICROS);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SoftwareReset);
-				CommandEnd();
-				delayMicroseconds(ST7735::RESET_WAIT_MICROS);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetSleepOff);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetDisplayOff);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::FrameRateControl1);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x00);
-				SpiInstance.transfer(0b111111);
-				SpiInstance.transfer(0b111111);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::FrameRateControl2);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b1111);
-				SpiInstance.transfer(0x01);
-				SpiInstance.transfer(0x01);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::FrameRateControl3);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x05);
-				SpiInstance.transfer(0x3c);
-				SpiInstance.transfer(0x3c);
-				SpiInstance.transfer(0x05);
-				SpiInstance.transfer(0x3c);
-				SpiInstance.transfer(0x3c);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::InversionControl);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x03);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerControl1);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b11111100);
-				SpiInstance.transfer(0x08);
-				SpiInstance.transfer(0b10);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerControl2);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0xC0);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerControl3);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x0D);
-				SpiInstance.transfer(0x00);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerControl4);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x8D);
-				SpiInstance.transfer(0x2A);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerControl5);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x8D);
-				SpiInstance.transfer(0xEE);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::GatePumpClockFrequency);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b11011000);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::NvmControlStatus);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b01000000);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerVmControl);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b001111);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PowerLControl);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0b10000);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetGamma);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x08);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetMemoryDataAccessControl);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(panel_t::Madctl);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetPixelFormat);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x05);
-				CommandEnd();
-				delay(10);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetGammaPositiveCorrection);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t*)ST7735::GammaPositiveCorrection, sizeof(ST7735::GammaPositiveCorrection));
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetGammaNegativeCorrection);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t*)ST7735::GammaNegativeCorrection, sizeof(ST7735::GammaNegativeCorrection));
-				CommandEnd();
-
-				const uint16_t x0 = (uint16_t)panel_t::XOffset;
-				const uint16_t y0 = (uint16_t)panel_t::YOffset;
-				const uint16_t x1 = (uint16_t)panel_t::XOffset + (uint16_t)panel_t::Width - 1;
-				const uint16_t y1 = (uint16_t)panel_t::YOffset + (uint16_t)panel_t::Height - 1;
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetColumnAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t)(x0 >> 8));
-				SpiInstance.transfer((uint8_t)(x0 & 0xFF));
-				SpiInstance.transfer((uint8_t)(x1 >> 8));
-				SpiInstance.transfer((uint8_t)(x1 & 0xFF));
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetRowAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t)(y0 >> 8));
-				SpiInstance.transfer((uint8_t)(y0 & 0xFF));
-				SpiInstance.transfer((uint8_t)(y1 >> 8));
-				SpiInstance.transfer((uint8_t)(y1 & 0xFF));
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)(panel_t::InvertColors
-					? ST7735::CommandEnum::SetInversionOn
-					: ST7735::CommandEnum::SetInversionOff));
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::TearingOff);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetIdleOff);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PartialDisplayOff);
-				CommandEnd();
-				delay(10);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetDisplayOn);
-				CommandEnd();
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7735::CommandEnum::PartialDisplayOn);
-				CommandEnd();
-				delay(255);
+				BaseClass::StartInitSequence(GetInitSequence(), Settings);
 
 				return true;
 			}
@@ -287,7 +107,92 @@ namespace Egfx
 		{
 			CommandStart(Settings);
 			SpiInstance.transfer((uint8_t)ST7735::CommandEnum::MemoryWrite);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
+		}
+
+	private:
+		static const uint8_t* GetInitSequence()
+		{
+			static constexpr uint16_t x0 = (uint16_t)panel_t::XOffset;
+			static constexpr uint16_t y0 = (uint16_t)panel_t::YOffset;
+			static constexpr uint16_t x1 = (uint16_t)panel_t::XOffset + (uint16_t)panel_t::Width - 1;
+			static constexpr uint16_t y1 = (uint16_t)panel_t::YOffset + (uint16_t)panel_t::Height - 1;
+
+			// Gamma corrections from the public ST7735 tables.
+			static constexpr const uint8_t(&gp)[16] = ST7735::GammaPositiveCorrection;
+			static constexpr const uint8_t(&gn)[16] = ST7735::GammaNegativeCorrection;
+
+			static constexpr uint8_t sequence[] PROGMEM
+			{
+				InitSequence::Reset, InitSequence::PeriodHigh(ST7735::RESET_DELAY_MICROS), InitSequence::PeriodLow(ST7735::RESET_DELAY_MICROS),
+				0, (uint8_t)ST7735::CommandEnum::SoftwareReset,
+				InitSequence::Delay, InitSequence::PeriodHigh(ST7735::RESET_WAIT_MICROS), InitSequence::PeriodLow(ST7735::RESET_WAIT_MICROS),
+				InitSequence::Commands + 2,
+				(uint8_t)ST7735::CommandEnum::SetSleepOff,
+				(uint8_t)ST7735::CommandEnum::SetDisplayOff,
+				3, (uint8_t)ST7735::CommandEnum::FrameRateControl1, 0x00, 0b111111, 0b111111,
+				3, (uint8_t)ST7735::CommandEnum::FrameRateControl2, 0b1111, 0x01, 0x01,
+				6, (uint8_t)ST7735::CommandEnum::FrameRateControl3, 0x05, 0x3c, 0x3c, 0x05, 0x3c, 0x3c,
+				1, (uint8_t)ST7735::CommandEnum::InversionControl, 0x03,
+				3, (uint8_t)ST7735::CommandEnum::PowerControl1, 0b11111100, 0x08, 0b10,
+				1, (uint8_t)ST7735::CommandEnum::PowerControl2, 0xC0,
+				2, (uint8_t)ST7735::CommandEnum::PowerControl3, 0x0D, 0x00,
+				2, (uint8_t)ST7735::CommandEnum::PowerControl4, 0x8D, 0x2A,
+				2, (uint8_t)ST7735::CommandEnum::PowerControl5, 0x8D, 0xEE,
+				1, (uint8_t)ST7735::CommandEnum::GatePumpClockFrequency, 0b11011000,
+				1, (uint8_t)ST7735::CommandEnum::NvmControlStatus, 0b01000000,
+				1, (uint8_t)ST7735::CommandEnum::PowerVmControl, 0b001111,
+				1, (uint8_t)ST7735::CommandEnum::PowerLControl, 0b10000,
+				1, (uint8_t)ST7735::CommandEnum::SetGamma, 0x08,
+				1, (uint8_t)ST7735::CommandEnum::SetMemoryDataAccessControl, panel_t::Madctl,
+				1, (uint8_t)ST7735::CommandEnum::SetPixelFormat, ST7735::PixelFormat(pushColorDepth),
+				InitSequence::Delay, InitSequence::PeriodHigh(10000), InitSequence::PeriodLow(10000),
+				sizeof(gp), (uint8_t)ST7735::CommandEnum::SetGammaPositiveCorrection,
+				gp[0], gp[1], gp[2], gp[3], gp[4], gp[5], gp[6], gp[7],
+				gp[8], gp[9], gp[10], gp[11], gp[12], gp[13], gp[14], gp[15],
+				sizeof(gn), (uint8_t)ST7735::CommandEnum::SetGammaNegativeCorrection,
+				gn[0], gn[1], gn[2], gn[3], gn[4], gn[5], gn[6], gn[7],
+				gn[8], gn[9], gn[10], gn[11], gn[12], gn[13], gn[14], gn[15],
+				4, (uint8_t)ST7735::CommandEnum::SetColumnAddress,
+				InitSequence::High(x0), InitSequence::Low(x0), InitSequence::High(x1), InitSequence::Low(x1),
+				4, (uint8_t)ST7735::CommandEnum::SetRowAddress,
+				InitSequence::High(y0), InitSequence::Low(y0), InitSequence::High(y1), InitSequence::Low(y1),
+				InitSequence::Commands + 4,
+				(uint8_t)(panel_t::InvertColors ? ST7735::CommandEnum::SetInversionOn : ST7735::CommandEnum::SetInversionOff),
+				(uint8_t)ST7735::CommandEnum::TearingOff,
+				(uint8_t)ST7735::CommandEnum::SetIdleOff,
+				(uint8_t)ST7735::CommandEnum::PartialDisplayOff,
+				InitSequence::Delay, InitSequence::PeriodHigh(10000), InitSequence::PeriodLow(10000),
+				InitSequence::Commands + 2,
+				(uint8_t)ST7735::CommandEnum::SetDisplayOn,
+				(uint8_t)ST7735::CommandEnum::PartialDisplayOn,
+				InitSequence::Delay, InitSequence::PeriodHigh(255000), InitSequence::PeriodLow(255000),
+				InitSequence::End
+			};
+
+			return sequence;
+		}
+
+	protected:
+		/// <summary>
+		/// Restricts the memory write to the given rows and restarts it.
+		/// Must be called inside an open buffer transaction.
+		/// </summary>
+		void SetRowWindow(const pixel_t startRow, const pixel_t endRow)
+		{
+			const uint16_t y0 = (uint16_t)panel_t::YOffset + startRow;
+			const uint16_t y1 = (uint16_t)panel_t::YOffset + endRow;
+
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7735::CommandEnum::SetRowAddress);
+			GpioPin<pinDC>::High();
+			SpiInstance.transfer((uint8_t)(y0 >> 8));
+			SpiInstance.transfer((uint8_t)(y0 & UINT8_MAX));
+			SpiInstance.transfer((uint8_t)(y1 >> 8));
+			SpiInstance.transfer((uint8_t)(y1 & UINT8_MAX));
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7735::CommandEnum::MemoryWrite);
+			GpioPin<pinDC>::High();
 		}
 	};
 
@@ -305,7 +210,56 @@ namespace Egfx
 	using ScreenDriverST7735S_160x128x16_SPI =
 		AbstractScreenDriverST7735S_SPI<uint16_t, ST7735::ST7735S_160x128, pinCS, pinDC, pinRST, spiSpeed>;
 
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed>
+	using ScreenDriverST7735S_80x160x12_SPI =
+		AbstractScreenDriverST7735S_SPI<uint16_t, ST7735::ST7735S, pinCS, pinDC, pinRST, spiSpeed, 12>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed>
+	using ScreenDriverST7735S_160x128x12_SPI =
+		AbstractScreenDriverST7735S_SPI<uint16_t, ST7735::ST7735S_160x128, pinCS, pinDC, pinRST, spiSpeed, 12>;
+
+	// 12 bit push from a Color16 (uint16_t) or Color8 (uint8_t) framebuffer, packed during push.
+	template<typename source_color_t,
+		const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t linesPerStep = 4>
+	using ScreenDriverST7735S_80x160x12_SPI_Pack =
+		TemplateScreenDriverRgb444Pack<ScreenDriverST7735S_80x160x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, source_color_t, linesPerStep>;
+
+	template<typename source_color_t,
+		const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t linesPerStep = 4>
+	using ScreenDriverST7735S_160x128x12_SPI_Pack =
+		TemplateScreenDriverRgb444Pack<ScreenDriverST7735S_160x128x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, source_color_t, linesPerStep>;
+
 	// Async variants
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t spiChunkDivisor = 2>
+	using ScreenDriverST7735S_80x160x12_SPI_Async =
+		TemplateScreenDriverSpiAsync<ScreenDriverST7735S_80x160x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t spiChunkDivisor = 2>
+	using ScreenDriverST7735S_160x128x12_SPI_Async =
+		TemplateScreenDriverSpiAsync<ScreenDriverST7735S_160x128x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
+
 	template<const uint8_t pinCS = UINT8_MAX,
 		const uint8_t pinDC = UINT8_MAX,
 		const uint8_t pinRST = UINT8_MAX,
@@ -322,6 +276,39 @@ namespace Egfx
 	using ScreenDriverST7735S_160x128x16_SPI_Async =
 		TemplateScreenDriverSpiAsync<ScreenDriverST7735S_160x128x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
 
+	// Row hash variants, push only the changed row blocks.
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7735S_80x160x16_SPI_RowHash =
+		TemplateScreenDriverRowHash<ScreenDriverST7735S_80x160x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7735S_160x128x16_SPI_RowHash =
+		TemplateScreenDriverRowHash<ScreenDriverST7735S_160x128x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7735S_80x160x12_SPI_RowHash =
+		TemplateScreenDriverRowHash<ScreenDriverST7735S_80x160x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7735S_160x128x12_SPI_RowHash =
+		TemplateScreenDriverRowHash<ScreenDriverST7735S_160x128x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
 #if defined(TEMPLATE_SCREEN_DRIVER_SPI_DMA)
 	// DMA variants
 	template<const uint8_t pinCS = UINT8_MAX,
@@ -347,7 +334,7 @@ namespace Egfx
 		const uint8_t pinRST = UINT8_MAX,
 		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -364,7 +351,7 @@ namespace Egfx
 		const uint8_t pinRST = UINT8_MAX,
 		const uint32_t spiSpeed = ST7735::SpiMaxSpeed,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -46,9 +46,9 @@ namespace Egfx
 			if (!BaseClass::Start())
 				return false;
 
-			BaseClass::PinReset(ST7789T3::RESET_DELAY_MICROS);
+			BaseClass::StartInitSequence(ST7789T3::Init::Sequence, Settings);
 
-			return Initialize();
+			return true;
 		}
 
 		void StartBuffer() override
@@ -57,7 +57,7 @@ namespace Egfx
 
 			BaseClass::CommandStart(Settings);
 			BaseClass::SpiInstance.transfer((uint8_t)ST7789T3::CommandEnum::MemoryWrite);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 		}
 
 		void EndBuffer() override
@@ -67,104 +67,6 @@ namespace Egfx
 		}
 
 	private:
-		bool Initialize()
-		{
-			// Reset + Sleep Out
-			SendCommand(ST7789T3::CommandEnum::SoftwareReset);
-			DelayMicros(ST7789T3::RESET_WAIT_MICROS);
-
-			SendCommand(ST7789T3::CommandEnum::SleepOut);
-			DelayMicros(ST7789T3::SLEEP_EXIT_DELAY_MICROS);
-
-			// Pixel format: RGB565
-			SendCommand(ST7789T3::CommandEnum::SetPixelFormat,
-				ST7789T3::PixelFormats::Rgb565);
-
-			// MADCTL: no rotation, no mirroring, BGR order
-			SendCommand(ST7789T3::CommandEnum::SetMemoryAccessControl, 0x08);
-
-			// Porch
-			{
-				const uint8_t d[]{ 0x0C, 0x0C, 0x00, 0x33, 0x33 };
-				SendCommand(ST7789T3::CommandEnum::PorchSetting, d, sizeof(d));
-			}
-
-			// Gate
-			{
-				const uint8_t d[]{ 0x35 };
-				SendCommand(ST7789T3::CommandEnum::GateControl, d, sizeof(d));
-			}
-
-			// VCOM
-			{
-				const uint8_t d[]{ 0x28 };
-				SendCommand(ST7789T3::CommandEnum::VCOMSSetting, d, sizeof(d));
-			}
-
-			// LCM
-			{
-				const uint8_t d[]{ 0x0C };
-				SendCommand(ST7789T3::CommandEnum::LCMControl, d, sizeof(d));
-			}
-
-			// VDV/VRH enable
-			{
-				const uint8_t d[]{ 0x01 };
-				SendCommand(ST7789T3::CommandEnum::VDVVRHEN, d, sizeof(d));
-			}
-
-			// VRH
-			{
-				const uint8_t d[]{ 0x10 };
-				SendCommand(ST7789T3::CommandEnum::VRHSet, d, sizeof(d));
-			}
-
-			// VDV
-			{
-				const uint8_t d[]{ 0x20 };
-				SendCommand(ST7789T3::CommandEnum::VDVSet, d, sizeof(d));
-			}
-
-			// Frame rate
-			{
-				const uint8_t d[]{ 0x0F };
-				SendCommand(ST7789T3::CommandEnum::FrameRateControl, d, sizeof(d));
-			}
-
-			// Power
-			{
-				const uint8_t d[]{ 0xA4, 0xA1 };
-				SendCommand(ST7789T3::CommandEnum::PowerControl1, d, sizeof(d));
-			}
-
-			// Gamma (JLX240)
-			{
-				const uint8_t d[]{
-					0xD0,0x00,0x02,0x07,0x0A,0x28,0x32,0x44,
-					0x42,0x06,0x0E,0x12,0x14,0x17
-				};
-				SendCommand(ST7789T3::CommandEnum::PositiveGamma, d, sizeof(d));
-			}
-			{
-				const uint8_t d[]{
-					0xD0,0x00,0x02,0x07,0x0A,0x28,0x31,0x54,
-					0x47,0x0E,0x1C,0x17,0x1B,0x1E
-				};
-				SendCommand(ST7789T3::CommandEnum::NegativeGamma, d, sizeof(d));
-			}
-
-			// Inversion ON
-			SendCommand(ST7789T3::CommandEnum::InversionOn);
-
-			SendCommand(ST7789T3::CommandEnum::NormalDisplayOn);
-			DelayMicros(ST7789T3::DISPLAY_ON_DELAY_MICROS);
-
-			SendCommand(ST7789T3::CommandEnum::DisplayOn);
-			DelayMicros(ST7789T3::DISPLAY_ON_DELAY_MICROS);
-
-			return true;
-		}
-
 		void ConfigureAddressWindow()
 		{
 			// Full 240320 window, no offsets.
@@ -183,17 +85,6 @@ namespace Egfx
 			SendCommand(ST7789T3::CommandEnum::SetRowAddress, raset, sizeof(raset));
 		}
 
-		void SendCommand(const ST7789T3::CommandEnum cmd)
-		{
-			SendCommand(cmd, nullptr, 0);
-		}
-
-		void SendCommand(const ST7789T3::CommandEnum cmd, uint8_t value)
-		{
-			const uint8_t d[]{ value };
-			SendCommand(cmd, d, 1);
-		}
-
 		void SendCommand(const ST7789T3::CommandEnum cmd,
 			const uint8_t* data, size_t len)
 		{
@@ -202,20 +93,13 @@ namespace Egfx
 
 			if (len && data)
 			{
-				digitalWrite(pinDC, HIGH);
+				GpioPin<pinDC>::High();
 				BaseClass::SpiTransfer(data, len);
-				digitalWrite(pinDC, LOW);
+				GpioPin<pinDC>::Low();
 			}
 
 			BaseClass::CommandEnd();
 		}
-
-		static void DelayMicros(uint32_t us)
-		{
-			if (!us) return;
-			delay(us / 1000);
-			delayMicroseconds(us % 1000);
-		}
 	};
 
 	template<const uint8_t pinCS = UINT8_MAX,
@@ -258,7 +142,7 @@ namespace Egfx
 		const uint32_t spiSpeed = ST7789T3::SpiDefaultSpeed,
 		const uint32_t pushSleepDuration = 0,
 		uint32_t stackHeight = 1500,
-		portBASE_TYPE priority = 1
+		UBaseType_t priority = 1
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
 		, const uint32_t coreAffinity = tskNO_AFFINITY
 #endif
@@ -5,6 +5,8 @@
 #include "TemplateScreenDriverRtos.h"
 #include "TemplateScreenDriverSpiAsync.h"
 #include "TemplateScreenDriverSpiDma.h"
+#include "TemplateScreenDriverRgb444Pack.h"
+#include "TemplateScreenDriverRowHash.h"
 #include "ST7789/ST7789.h"
 
 namespace Egfx
@@ -17,22 +19,31 @@ namespace Egfx
 		const uint8_t pinCS,
 		const uint8_t pinDC,
 		const uint8_t pinRST,
-		const uint32_t spiSpeed>
-	class AbstractScreenDriverST7789_SPI : public AbstractScreenDriverSPI<Egfx::GetFrameBufferSize<pixel_color_t>(width, height), width, height, pinCS, pinDC, pinRST>
+		const uint32_t spiSpeed,
+		const uint8_t pushColorDepth = 16>
+	class AbstractScreenDriverST7789_SPI : public AbstractScreenDriverSPI<
+		(pushColorDepth == 12) ? Egfx::GetFrameBufferColor12Size(width, height) : Egfx::GetFrameBufferSize<pixel_color_t>(width, height),
+		width, height, pinCS, pinDC, pinRST>
 	{
 	private:
-		using BaseClass = AbstractScreenDriverSPI<Egfx::GetFrameBufferSize<pixel_color_t>(width, height), width, height, pinCS, pinDC, pinRST>;
+		using BaseClass = AbstractScreenDriverSPI<
+			(pushColorDepth == 12) ? Egfx::GetFrameBufferColor12Size(width, height) : Egfx::GetFrameBufferSize<pixel_color_t>(width, height),
+			width, height, pinCS, pinDC, pinRST>;
 
 	public:
 		using BaseClass::ScreenWidth;
 		using BaseClass::ScreenHeight;
 		using BaseClass::BufferSize;
 
+		/// <summary>
+		/// Vertical scroll is supported, see SetScrollArea() and SetScrollStart().
+		/// </summary>
+		static constexpr bool HardwareScroll = true;
+
 	protected:
 		using BaseClass::SpiInstance;
 		using BaseClass::CommandStart;
 		using BaseClass::CommandEnd;
-		using BaseClass::PinReset;
 
 	private:
 		SPISettings Settings;
@@ -51,45 +62,7 @@ namespace Egfx
 		{
 			if (BaseClass::Start())
 			{
-				PinReset(ST7789::RESET_DELAY_MICROS);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SoftwareReset);
-				CommandEnd();
-				delayMicroseconds(ST7789::RESET_WAIT_MICROS);
-
-				CommandStart(Settings);
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetSleepOff);
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetPixelFormat);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x55);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetMemoryDataAccessControl);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer(0x00);
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetColumnAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t)((offsetX) >> 8));
-				SpiInstance.transfer((uint8_t)(offsetX & UINT8_MAX));
-				SpiInstance.transfer((uint8_t)((((uint16_t)offsetX + (uint16_t)width - 1)) >> 8));
-				SpiInstance.transfer((uint8_t)(((uint16_t)offsetX + (uint16_t)width - 1) & UINT8_MAX));
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetRowAddress);
-				digitalWrite(pinDC, HIGH);
-				SpiInstance.transfer((uint8_t)((offsetY) >> 8));
-				SpiInstance.transfer((uint8_t)(offsetY & UINT8_MAX));
-				SpiInstance.transfer((uint8_t)((((uint16_t)offsetY + (uint16_t)height - 1)) >> 8));
-				SpiInstance.transfer((uint8_t)(((uint16_t)offsetY + (uint16_t)height - 1) & UINT8_MAX));
-				digitalWrite(pinDC, LOW);
-
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetInversionOn);
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::PartialDisplayOff);
-				SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetDisplayOn);
-				CommandEnd();
+				BaseClass::StartInitSequence(GetInitSequence(), Settings);
 
 				return true;
 			}
@@ -101,7 +74,7 @@ namespace Egfx
 		{
 			CommandStart(Settings);
 			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::MemoryWrite);
-			digitalWrite(pinDC, HIGH);
+			GpioPin<pinDC>::High();
 		}
 
 		virtual void EndBuffer()
@@ -109,6 +82,92 @@ namespace Egfx
 			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::Nop);
 			BaseClass::EndBuffer();
 		}
+
+	private:
+		static const uint8_t* GetInitSequence()
+		{
+			static constexpr uint8_t sequence[] PROGMEM
+			{
+				InitSequence::Reset, InitSequence::PeriodHigh(ST7789::RESET_DELAY_MICROS), InitSequence::PeriodLow(ST7789::RESET_DELAY_MICROS),
+				0, (uint8_t)ST7789::CommandEnum::SoftwareReset,
+				InitSequence::Delay, InitSequence::PeriodHigh(ST7789::RESET_WAIT_MICROS), InitSequence::PeriodLow(ST7789::RESET_WAIT_MICROS),
+				0, (uint8_t)ST7789::CommandEnum::SetSleepOff,
+				1, (uint8_t)ST7789::CommandEnum::SetPixelFormat, ST7789::PixelFormat(pushColorDepth),
+				1, (uint8_t)ST7789::CommandEnum::SetMemoryDataAccessControl, 0x00,
+				4, (uint8_t)ST7789::CommandEnum::SetColumnAddress,
+				InitSequence::High(offsetX), InitSequence::Low(offsetX),
+				InitSequence::High(offsetX + width - 1), InitSequence::Low(offsetX + width - 1),
+				4, (uint8_t)ST7789::CommandEnum::SetRowAddress,
+				InitSequence::High(offsetY), InitSequence::Low(offsetY),
+				InitSequence::High(offsetY + height - 1), InitSequence::Low(offsetY + height - 1),
+				InitSequence::Commands + 3,
+				(uint8_t)ST7789::CommandEnum::SetInversionOn,
+				(uint8_t)ST7789::CommandEnum::PartialDisplayOff,
+				(uint8_t)ST7789::CommandEnum::SetDisplayOn,
+				InitSequence::End
+			};
+
+			return sequence;
+		}
+
+	protected:
+		/// <summary>
+		/// Restricts the memory write to the given rows and restarts it.
+		/// Must be called inside an open buffer transaction.
+		/// </summary>
+		void SetRowWindow(const pixel_t startRow, const pixel_t endRow)
+		{
+			const uint16_t y0 = (uint16_t)offsetY + startRow;
+			const uint16_t y1 = (uint16_t)offsetY + endRow;
+
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::SetRowAddress);
+			GpioPin<pinDC>::High();
+			SpiInstance.transfer((uint8_t)(y0 >> 8));
+			SpiInstance.transfer((uint8_t)(y0 & UINT8_MAX));
+			SpiInstance.transfer((uint8_t)(y1 >> 8));
+			SpiInstance.transfer((uint8_t)(y1 & UINT8_MAX));
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::MemoryWrite);
+			GpioPin<pinDC>::High();
+		}
+
+		/// <summary>
+		/// Defines the hardware vertical scroll area, in screen rows. Rows outside the area stay fixed.
+		/// Must be called inside an open buffer transaction.
+		/// </summary>
+		void SetScrollArea(const pixel_t top, const pixel_t rows)
+		{
+			const uint16_t topFixed = (uint16_t)offsetY + top;
+			const uint16_t bottomFixed = ST7789::Height - topFixed - rows;
+
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::VerticalScrollingDefinition);
+			GpioPin<pinDC>::High();
+			SpiInstance.transfer((uint8_t)(topFixed >> 8));
+			SpiInstance.transfer((uint8_t)(topFixed & UINT8_MAX));
+			SpiInstance.transfer((uint8_t)(rows >> 8));
+			SpiInstance.transfer((uint8_t)(rows & UINT8_MAX));
+			SpiInstance.transfer((uint8_t)(bottomFixed >> 8));
+			SpiInstance.transfer((uint8_t)(bottomFixed & UINT8_MAX));
+			GpioPin<pinDC>::Low();
+		}
+
+		/// <summary>
+		/// Sets the row shown at the top of the scroll area, as an offset from the area's top row.
+		/// Must be called inside an open buffer transaction.
+		/// </summary>
+		void SetScrollStart(const pixel_t top, const pixel_t offset)
+		{
+			const uint16_t line = (uint16_t)offsetY + top + offset;
+
+			GpioPin<pinDC>::Low();
+			SpiInstance.transfer((uint8_t)ST7789::CommandEnum::VerticalScrollStartAddress);
+			GpioPin<pinDC>::High();
+			SpiInstance.transfer((uint8_t)(line >> 8));
+			SpiInstance.transfer((uint8_t)(line & UINT8_MAX));
+			GpioPin<pinDC>::Low();
+		}
 	};
 
 	template<const uint8_t pinCS = UINT8_MAX,
@@ -123,6 +182,49 @@ namespace Egfx
 		const uint32_t spiSpeed = 4000000>
 	using ScreenDriverST7789_172x320x16_SPI = AbstractScreenDriverST7789_SPI<uint16_t, 172, 320, 34, 0, pinCS, pinDC, pinRST, spiSpeed>;
 
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000>
+	using ScreenDriverST7789_240x240x12_SPI = AbstractScreenDriverST7789_SPI<uint16_t, 240, 240, 0, 0, pinCS, pinDC, pinRST, spiSpeed, 12>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000>
+	using ScreenDriverST7789_172x320x12_SPI = AbstractScreenDriverST7789_SPI<uint16_t, 172, 320, 34, 0, pinCS, pinDC, pinRST, spiSpeed, 12>;
+
+	// 12 bit push from a Color16 (uint16_t) or Color8 (uint8_t) framebuffer, packed during push.
+	template<typename source_color_t,
+		const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t linesPerStep = 4>
+	using ScreenDriverST7789_240x240x12_SPI_Pack = TemplateScreenDriverRgb444Pack<ScreenDriverST7789_240x240x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, source_color_t, linesPerStep>;
+
+	template<typename source_color_t,
+		const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t linesPerStep = 4>
+	using ScreenDriverST7789_172x320x12_SPI_Pack = TemplateScreenDriverRgb444Pack<ScreenDriverST7789_172x320x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, source_color_t, linesPerStep>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t spiChunkDivisor = 2>
+	using ScreenDriverST7789_240x240x12_SPI_Async = TemplateScreenDriverSpiAsync<ScreenDriverST7789_240x240x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t spiChunkDivisor = 2>
+	using ScreenDriverST7789_172x320x12_SPI_Async = TemplateScreenDriverSpiAsync<ScreenDriverST7789_172x320x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
+
 	template<const uint8_t pinCS = UINT8_MAX,
 		const uint8_t pinDC = UINT8_MAX,
 		const uint8_t pinRST = UINT8_MAX,
@@ -137,6 +239,35 @@ namespace Egfx
 		const uint8_t spiChunkDivisor = 2>
 	using ScreenDriverST7789_172x320x16_SPI_Async = TemplateScreenDriverSpiAsync<ScreenDriverST7789_172x320x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, spiChunkDivisor>;
 
+	// Row hash variants, push only the changed row blocks.
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7789_240x240x16_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverST7789_240x240x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7789_172x320x16_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverST7789_172x320x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7789_240x240x12_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverST7789_240x240x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint8_t rowsPerBlock = 8>
+	using ScreenDriverST7789_172x320x12_SPI_RowHash = TemplateScreenDriverRowHash<ScreenDriverST7789_172x320x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, rowsPerBlock>;
+
 #if defined(TEMPLATE_SCREEN_DRIVER_SPI_DMA)
 	template<const uint8_t pinCS = UINT8_MAX,
 		const uint8_t pinDC = UINT8_MAX,
@@ -151,6 +282,20 @@ namespace Egfx
 		const uint32_t spiSpeed = 4000000,
 		const uint32_t pushSleepDuration = 0>
 	using ScreenDriverST7789_172x320x16_SPI_Dma = TemplateScreenDriverSpiDma<ScreenDriverST7789_172x320x16_SPI<pinCS, pinDC, pinRST, spiSpeed>, pushSleepDuration, ST7789::SpiMaxChunkSize>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint32_t pushSleepDuration = 0>
+	using ScreenDriverST7789_240x240x12_SPI_Dma = TemplateScreenDriverSpiDma<ScreenDriverST7789_240x240x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, pushSleepDuration, ST7789::SpiMaxChunkSize>;
+
+	template<const uint8_t pinCS = UINT8_MAX,
+		const uint8_t pinDC = UINT8_MAX,
+		const uint8_t pinRST = UINT8_MAX,
+		const uint32_t spiSpeed = 4000000,
+		const uint32_t pushSleepDuration = 0>
+	using ScreenDriverST7789_172x320x12_SPI_Dma = TemplateScreenDriverSpiDma<ScreenDriverST7789_172x320x12_SPI<pinCS, pinDC, pinRST, spiSpeed>, pushSleepDuration, ST7789::SpiMaxChunkSize>;
 #endif
 
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS)
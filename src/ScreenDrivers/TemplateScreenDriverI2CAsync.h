@@ -30,10 +30,16 @@ namespace Egfx
 		size_t PushIndex = 0;
 
 	public:
-		TemplateScreenDriverI2CAsync(TwoWire& wire) : InlineI2cScreenDriver(wire) {}
+		TemplateScreenDriverI2CAsync(Egfx::WireType& wire) : InlineI2cScreenDriver(wire) {}
 		
 		~TemplateScreenDriverI2CAsync() override = default;
 
+		size_t GetPushedSize() final
+		{
+			// Chunk transfers are blocking, every started chunk is done.
+			return PushIndex;
+		}
+
 		virtual bool Start()
 		{
 			return CHUNK_SIZE <= BufferSize
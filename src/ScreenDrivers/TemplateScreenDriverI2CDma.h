@@ -25,15 +25,22 @@ namespace Egfx
 
 	private:
 		size_t PushIndex = 0;
+		size_t PushedSize = 0;
 
 	public:
-		TemplateScreenDriverI2CDma(TwoWire& wire) : InlineI2cScreenDriver(wire) {}
+		TemplateScreenDriverI2CDma(Egfx::WireType& wire) : InlineI2cScreenDriver(wire) {}
 		
 		~TemplateScreenDriverI2CDma() override = default;
 
+		size_t GetPushedSize() final
+		{
+			return PushedSize;
+		}
+
 		virtual uint32_t PushBuffer(const uint8_t* frameBuffer) override
 		{
 			PushIndex = 0;
+			PushedSize = 0;
 
 			// Kick off first transfer immediately.
 			if (BUFFER_WHOLE > 0)
@@ -63,6 +70,7 @@ namespace Egfx
 			{
 				return true;
 			}
+			PushedSize = PushIndex;
 
 			// Start next transfer if any data remains.
 			if (BUFFER_WHOLE > 0 && PushIndex < REMAINDER_START)
@@ -0,0 +1,155 @@
+#ifndef _TEMPLATE_SCREEN_DRIVER_RGB444_PACK_h
+#define _TEMPLATE_SCREEN_DRIVER_RGB444_PACK_h
+
+#include "../Model/RgbColor.h"
+#include "../Model/GraphicsBuffer.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Packs framebuffer pixels into the 4-4-4 wire format: 2 pixels every 3 bytes (RG BR GB).
+	/// Specialized for each supported source framebuffer color.
+	/// </summary>
+	/// <typeparam name="source_color_t">Source framebuffer color type.</typeparam>
+	template<typename source_color_t>
+	struct Rgb444Packer;
+
+	/// <summary>
+	/// 5-6-5 (Color16 framebuffer, high byte first) to 4-4-4 packer.
+	/// </summary>
+	template<>
+	struct Rgb444Packer<uint16_t>
+	{
+		static void Pack(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const size_t pairs = pixelCount >> 1;
+			for (size_t i = 0; i < pairs; i++)
+			{
+				// RRRRRGGG GGGBBBBB RRRRRGGG GGGBBBBB -> RRRRGGGG BBBBRRRR GGGGBBBB
+				const uint8_t h0 = source[0];
+				const uint8_t l0 = source[1];
+				const uint8_t h1 = source[2];
+				const uint8_t l1 = source[3];
+				destination[0] = (h0 & 0xF0) | ((h0 & 0x07) << 1) | (l0 >> 7);
+				destination[1] = ((l0 << 3) & 0xF0) | (h1 >> 4);
+				destination[2] = ((h1 & 0x07) << 5) | ((l1 >> 3) & 0x10) | ((l1 >> 1) & 0x0F);
+				source += 4;
+				destination += 3;
+			}
+
+			if (pixelCount & 1)
+			{
+				const uint16_t color = Rgb::Color444From565(((uint16_t)source[0] << 8) | source[1]);
+				destination[0] = uint8_t(color >> 4);
+				destination[1] = uint8_t(Rgb::B4(color) << 4);
+			}
+		}
+	};
+
+	/// <summary>
+	/// 3-3-2 (Color8 framebuffer) to 4-4-4 packer.
+	/// </summary>
+	template<>
+	struct Rgb444Packer<uint8_t>
+	{
+		static void Pack(const uint8_t* source, uint8_t* destination, const size_t pixelCount)
+		{
+			const size_t pairs = pixelCount >> 1;
+			for (size_t i = 0; i < pairs; i++)
+			{
+				const uint16_t color0 = Rgb::Color444From332(source[0]);
+				const uint16_t color1 = Rgb::Color444From332(source[1]);
+				destination[0] = uint8_t(color0 >> 4);
+				destination[1] = uint8_t(Rgb::B4(color0) << 4) | Rgb::R4(color1);
+				destination[2] = uint8_t(color1);
+				source += 2;
+				destination += 3;
+			}
+
+			if (pixelCount & 1)
+			{
+				const uint16_t color = Rgb::Color444From332(source[0]);
+				destination[0] = uint8_t(color >> 4);
+				destination[1] = uint8_t(Rgb::B4(color) << 4);
+			}
+		}
+	};
+
+	/// <summary>
+	/// Wraps a 12 bit Inline SPI ScreenDriver to push a 16 or 8 bit framebuffer, packed to 4-4-4 during push.
+	/// Cuts bus bytes per frame by 25% against 16 bit, at the cost of a small line buffer.
+	/// The frame is pushed in blocks of lines, one block per PushingBuffer() call.
+	/// </summary>
+	/// <typeparam name="InlineSpiScreenDriver">12 bit screen driver, with BufferSize matching GetFrameBufferColor12Size().</typeparam>
+	/// <typeparam name="source_color_t">Source framebuffer color type: uint16_t for Color16 (5-6-5), uint8_t for Color8 (3-3-2).</typeparam>
+	/// <typeparam name="linesPerStep">Number of lines packed and pushed on each step.</typeparam>
+	template<typename InlineSpiScreenDriver,
+		typename source_color_t = uint16_t,
+		const uint8_t linesPerStep = 4>
+	class TemplateScreenDriverRgb444Pack : public InlineSpiScreenDriver
+	{
+	public:
+		using InlineSpiScreenDriver::ScreenWidth;
+		using InlineSpiScreenDriver::ScreenHeight;
+
+		/// <summary>
+		/// Source framebuffer size, not the bus transfer size.
+		/// </summary>
+		static constexpr size_t BufferSize = GetFrameBufferSize<source_color_t>(ScreenWidth, ScreenHeight);
+
+	private:
+		using Packer = Rgb444Packer<source_color_t>;
+
+		static_assert(InlineSpiScreenDriver::BufferSize == GetFrameBufferColor12Size(ScreenWidth, ScreenHeight), "Inline driver must push 12 bit color.");
+		static_assert(linesPerStep > 0, "At least one line must be pushed per step.");
+
+		static constexpr size_t PIXEL_COUNT = (size_t)ScreenWidth * ScreenHeight;
+
+		// Keep whole pixel pairs on every step, so only the last step may end on a half triplet.
+		static constexpr size_t STEP_PIXELS = ((((size_t)ScreenWidth * linesPerStep) & ~size_t(1)) > 0) ?
+			(((size_t)ScreenWidth * linesPerStep) & ~size_t(1)) : 2;
+		static constexpr size_t LINE_BUFFER_SIZE = (STEP_PIXELS / 2) * 3;
+
+	private:
+		uint8_t LineBuffer[LINE_BUFFER_SIZE]{};
+
+		size_t PushIndex = 0;
+
+	public:
+		TemplateScreenDriverRgb444Pack(Egfx::SpiType& spi) : InlineSpiScreenDriver(spi) {}
+
+		~TemplateScreenDriverRgb444Pack() override = default;
+
+		uint32_t PushBuffer(const uint8_t* frameBuffer) final
+		{
+			PushIndex = 0;
+			PushStep(frameBuffer);
+
+			return 0;
+		}
+
+		bool PushingBuffer(const uint8_t* frameBuffer) final
+		{
+			if (PushIndex < PIXEL_COUNT)
+			{
+				PushStep(frameBuffer);
+
+				return true;
+			}
+
+			return false;
+		}
+
+	private:
+		void PushStep(const uint8_t* frameBuffer)
+		{
+			const size_t count = ((PIXEL_COUNT - PushIndex) > STEP_PIXELS) ? STEP_PIXELS : (PIXEL_COUNT - PushIndex);
+
+			Packer::Pack(&frameBuffer[PushIndex * sizeof(source_color_t)], LineBuffer, count);
+			InlineSpiScreenDriver::SpiTransfer(LineBuffer, ((count * 3) + 1) / 2);
+
+			PushIndex += count;
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,436 @@
+#ifndef _TEMPLATE_SCREEN_DRIVER_ROW_HASH_h
+#define _TEMPLATE_SCREEN_DRIVER_ROW_HASH_h
+
+#include <stdint.h>
+#include <string.h>
+#include "../Model/IScrollRegion.h"
+
+namespace Egfx
+{
+	/// <summary>
+	/// Wraps an Inline SPI ScreenDriver that can open arbitrary row windows, to push only the rows that changed since the last frame.
+	/// Each block of rows is hashed on push and compared with the previous frame's hash.
+	/// Unlike draw-time damage tracking, this needs no cooperation from views and catches identical redraws.
+	/// When no block changed, the push is skipped entirely and no bus transaction is started.
+	/// Inline driver must provide SetRowWindow(startRow, endRow), callable inside an open buffer transaction.
+	/// Inline driver must declare HardwareScroll. When true, it must also provide SetScrollArea(top, height) and SetScrollStart(top, offset):
+	/// a scroll reprograms the panel's scroll start and keeps the hashes of the rows that moved, so only exposed rows are pushed.
+	/// Without hardware scroll, SetScrollRegion() returns false.
+	/// </summary>
+	/// <typeparam name="InlineSpiScreenDriver">Inline screen driver with SetRowWindow() support.</typeparam>
+	/// <typeparam name="rowsPerBlock">Number of rows covered by each hash.</typeparam>
+	template<typename InlineSpiScreenDriver,
+		const uint8_t rowsPerBlock = 8>
+	class TemplateScreenDriverRowHash : public InlineSpiScreenDriver, public IScrollRegion
+	{
+	public:
+		using InlineSpiScreenDriver::BufferSize;
+		using InlineSpiScreenDriver::ScreenWidth;
+		using InlineSpiScreenDriver::ScreenHeight;
+
+	private:
+		static constexpr size_t ROW_SIZE = BufferSize / ScreenHeight;
+		static constexpr uint16_t BLOCK_COUNT = (ScreenHeight + rowsPerBlock - 1) / rowsPerBlock;
+		static constexpr size_t BLOCK_SIZE = ROW_SIZE * rowsPerBlock;
+
+		static_assert(rowsPerBlock > 0, "At least one row per block is required.");
+		static_assert(ROW_SIZE * ScreenHeight == BufferSize, "Rows must start on a byte boundary.");
+
+		static constexpr uint32_t HASH_SEED = 2166136261;
+		static constexpr uint32_t HASH_PRIME = 16777619;
+
+		using ScrollTag = typename TypeTraits::TypeConditional::conditional_type<
+			TypeTraits::TypeDispatch::TrueType,
+			TypeTraits::TypeDispatch::FalseType,
+			InlineSpiScreenDriver::HardwareScroll>::type;
+
+	private:
+		uint32_t Hashes[BLOCK_COUNT]{};
+		uint8_t DirtyBlocks[(BLOCK_COUNT + 7) / 8]{};
+		uint8_t ForcedBlocks[(BLOCK_COUNT + 7) / 8]{};
+
+		uint16_t BlockIndex = 0;
+		bool HashesValid = false;
+		bool Pushing = false;
+
+	private:
+		pixel_t ScrollTop = 0;
+		pixel_t ScrollHeight = 0;
+		pixel_t ScrollOffset = 0;
+		bool ScrollAreaPending = false;
+		bool ScrollStartPending = false;
+
+	public:
+		TemplateScreenDriverRowHash(Egfx::SpiType& spi) : InlineSpiScreenDriver(spi) {}
+
+		~TemplateScreenDriverRowHash() override = default;
+
+		bool Start() override
+		{
+			// Panel RAM content is unknown, the first frame is always pushed whole.
+			HashesValid = false;
+
+			// Controller reset clears the scroll state.
+			ScrollTop = 0;
+			ScrollHeight = 0;
+			ScrollOffset = 0;
+			ScrollAreaPending = false;
+			ScrollStartPending = false;
+
+			return InlineSpiScreenDriver::Start();
+		}
+
+		/// <summary>
+		/// Forces the next frame to be pushed whole.
+		/// </summary>
+		void Invalidate()
+		{
+			HashesValid = false;
+		}
+
+		/// <summary>
+		/// Whether the rows are unchanged since they were last pushed, so display RAM holds the framebuffer's rows.
+		/// Checks whole blocks, including the other rows of the first and last block.
+		/// </summary>
+		/// <param name="frameBuffer">The framebuffer that is pushed.</param>
+		/// <param name="top">First row.</param>
+		/// <param name="bottom">Last row.</param>
+		bool RowsPushed(const uint8_t* frameBuffer, const pixel_t top, const pixel_t bottom) const
+		{
+			if (!HashesValid)
+			{
+				return false;
+			}
+
+			const uint16_t lastBlock = bottom / rowsPerBlock;
+			for (uint16_t block = top / rowsPerBlock; block <= lastBlock; block++)
+			{
+				if (IsBlockSet(ForcedBlocks, block)
+					|| GetBlockHash(frameBuffer, block) != Hashes[block])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Marks rows as pushed, after the controller drew the same change into display RAM, so the next push skips them.
+		/// Only valid if RowsPushed() was true before the framebuffer and display RAM were both updated.
+		/// </summary>
+		/// <param name="frameBuffer">The framebuffer that is pushed.</param>
+		/// <param name="top">First row.</param>
+		/// <param name="bottom">Last row.</param>
+		void MarkRowsPushed(const uint8_t* frameBuffer, const pixel_t top, const pixel_t bottom)
+		{
+			const uint16_t lastBlock = bottom / rowsPerBlock;
+			for (uint16_t block = top / rowsPerBlock; block <= lastBlock; block++)
+			{
+				Hashes[block] = GetBlockHash(frameBuffer, block);
+			}
+		}
+
+		/// <summary>
+		/// Sets the hardware scroll region, applied on the next push.
+		/// Region must be aligned to rowsPerBlock, or end at the bottom of the screen.
+		/// </summary>
+		/// <param name="top">First row of the scroll region.</param>
+		/// <param name="height">Number of rows in the scroll region, 0 to disable scrolling.</param>
+		/// <returns>False if the region is not valid, or the driver has no hardware scroll.</returns>
+		bool SetScrollRegion(const pixel_t top, const pixel_t height) final
+		{
+			if (!InlineSpiScreenDriver::HardwareScroll)
+			{
+				return false;
+			}
+
+			if (height == 0)
+			{
+				if (ScrollHeight > 0)
+				{
+					ForceRows(ScrollTop, ScrollHeight);
+				}
+				ScrollTop = 0;
+				ScrollHeight = 0;
+			}
+			else if ((top % rowsPerBlock) != 0
+				|| ((uint32_t)top + height) > ScreenHeight
+				|| (((top + height) % rowsPerBlock) != 0 && ((uint32_t)top + height) != ScreenHeight))
+			{
+				return false;
+			}
+			else
+			{
+				// Display RAM rows no longer match the previous mapping.
+				if (ScrollHeight > 0)
+				{
+					ForceRows(ScrollTop, ScrollHeight);
+				}
+				ScrollTop = top;
+				ScrollHeight = height;
+				ForceRows(ScrollTop, ScrollHeight);
+			}
+
+			ScrollOffset = 0;
+			ScrollAreaPending = true;
+			ScrollStartPending = true;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Scrolls the hardware scroll region, applied on the next push.
+		/// The rendered frame is expected to show the region's content scrolled by the same amount.
+		/// With rowsPerBlock aligned steps, only the exposed rows are pushed.
+		/// </summary>
+		/// <param name="lines">Positive moves content up, negative moves content down.</param>
+		void Scroll(const int16_t lines) final
+		{
+			if (ScrollHeight == 0 || lines == 0)
+			{
+				return;
+			}
+
+			const pixel_t shift = (pixel_t)MinValue<int32_t>(AbsValue<int32_t>(lines), ScrollHeight);
+			if (lines > 0)
+			{
+				ScrollOffset = (ScrollOffset + shift) % ScrollHeight;
+			}
+			else
+			{
+				ScrollOffset = (ScrollOffset + ScrollHeight - shift) % ScrollHeight;
+			}
+			ScrollStartPending = true;
+
+			const uint16_t firstBlock = ScrollTop / rowsPerBlock;
+			const uint16_t blockCount = (ScrollHeight + rowsPerBlock - 1) / rowsPerBlock;
+			if ((shift % rowsPerBlock) != 0
+				|| (ScrollHeight % rowsPerBlock) != 0
+				|| shift >= ScrollHeight)
+			{
+				// Hashes can't follow the content, push the whole region.
+				ForceRows(ScrollTop, ScrollHeight);
+			}
+			else
+			{
+				const uint16_t blockShift = shift / rowsPerBlock;
+				if (lines > 0)
+				{
+					for (uint16_t i = 0; i < blockCount - blockShift; i++)
+					{
+						Hashes[firstBlock + i] = Hashes[firstBlock + i + blockShift];
+					}
+					ForceRows(ScrollTop + ScrollHeight - shift, shift);
+				}
+				else
+				{
+					for (uint16_t i = blockCount - 1; i >= blockShift; i--)
+					{
+						Hashes[firstBlock + i] = Hashes[firstBlock + i - blockShift];
+					}
+					ForceRows(ScrollTop, shift);
+				}
+			}
+		}
+
+		void StartBuffer() final
+		{
+			// Bus transaction is deferred to the first changed block.
+			Pushing = false;
+		}
+
+		uint32_t PushBuffer(const uint8_t* frameBuffer) final
+		{
+			for (uint16_t block = 0; block < BLOCK_COUNT; block++)
+			{
+				const uint32_t hash = GetBlockHash(frameBuffer, block);
+				if (!HashesValid || hash != Hashes[block] || IsBlockSet(ForcedBlocks, block))
+				{
+					Hashes[block] = hash;
+					DirtyBlocks[block >> 3] |= uint8_t(1) << (block & 7);
+				}
+				else
+				{
+					DirtyBlocks[block >> 3] &= ~(uint8_t(1) << (block & 7));
+				}
+			}
+			memset(ForcedBlocks, 0, sizeof(ForcedBlocks));
+			HashesValid = true;
+			BlockIndex = 0;
+
+			if (ScrollAreaPending || ScrollStartPending)
+			{
+				ApplyScroll(ScrollTag{});
+			}
+
+			PushRun(frameBuffer);
+
+			return 0;
+		}
+
+		bool PushingBuffer(const uint8_t* frameBuffer) final
+		{
+			return PushRun(frameBuffer);
+		}
+
+		void EndBuffer() final
+		{
+			if (Pushing)
+			{
+				Pushing = false;
+				InlineSpiScreenDriver::EndBuffer();
+			}
+		}
+
+	private:
+		void ApplyScroll(TypeTraits::TypeDispatch::TrueType)
+		{
+			StartTransaction();
+			if (ScrollAreaPending)
+			{
+				ScrollAreaPending = false;
+				if (ScrollHeight > 0)
+				{
+					InlineSpiScreenDriver::SetScrollArea(ScrollTop, ScrollHeight);
+				}
+				else
+				{
+					InlineSpiScreenDriver::SetScrollArea(0, ScreenHeight);
+				}
+			}
+			ScrollStartPending = false;
+			InlineSpiScreenDriver::SetScrollStart(ScrollTop, ScrollOffset);
+		}
+
+		void ApplyScroll(TypeTraits::TypeDispatch::FalseType)
+		{
+			ScrollAreaPending = false;
+			ScrollStartPending = false;
+		}
+
+		/// <summary>
+		/// Pushes the next run of consecutive changed blocks.
+		/// </summary>
+		/// <returns>True if there may be more runs to push.</returns>
+		bool PushRun(const uint8_t* frameBuffer)
+		{
+			while (BlockIndex < BLOCK_COUNT && !IsDirty(BlockIndex))
+			{
+				BlockIndex++;
+			}
+
+			if (BlockIndex >= BLOCK_COUNT)
+			{
+				return false;
+			}
+
+			// Runs don't cross the scroll region edges, as rows inside are remapped.
+			const uint16_t startBlock = BlockIndex;
+			const bool scrolled = InScrollRegion(startBlock);
+			while (BlockIndex < BLOCK_COUNT && IsDirty(BlockIndex) && InScrollRegion(BlockIndex) == scrolled)
+			{
+				BlockIndex++;
+			}
+
+			const pixel_t startRow = (pixel_t)startBlock * rowsPerBlock;
+			const pixel_t endRow = ((size_t)BlockIndex * rowsPerBlock > ScreenHeight) ?
+				(ScreenHeight - 1) : ((pixel_t)BlockIndex * rowsPerBlock - 1);
+			const pixel_t rowCount = endRow - startRow + 1;
+
+			StartTransaction();
+			if (scrolled)
+			{
+				// Map to the display RAM rows currently shown, wrapping around the region.
+				const pixel_t ramStart = ScrollTop + ((startRow - ScrollTop + ScrollOffset) % ScrollHeight);
+				const pixel_t firstCount = MinValue<pixel_t>(rowCount, ScrollTop + ScrollHeight - ramStart);
+				PushRows(frameBuffer, startRow, ramStart, firstCount);
+				if (firstCount < rowCount)
+				{
+					PushRows(frameBuffer, startRow + firstCount, ScrollTop, rowCount - firstCount);
+				}
+			}
+			else
+			{
+				PushRows(frameBuffer, startRow, startRow, rowCount);
+			}
+
+			return BlockIndex < BLOCK_COUNT;
+		}
+
+		void PushRows(const uint8_t* frameBuffer, const pixel_t sourceRow, const pixel_t ramRow, const pixel_t rowCount)
+		{
+			InlineSpiScreenDriver::SetRowWindow(ramRow, ramRow + rowCount - 1);
+			InlineSpiScreenDriver::SpiTransfer(&frameBuffer[ROW_SIZE * sourceRow], ROW_SIZE * rowCount);
+		}
+
+		void StartTransaction()
+		{
+			if (!Pushing)
+			{
+				Pushing = true;
+				InlineSpiScreenDriver::StartBuffer();
+			}
+		}
+
+		bool InScrollRegion(const uint16_t block) const
+		{
+			return ScrollHeight > 0
+				&& ((size_t)block * rowsPerBlock) >= (size_t)ScrollTop
+				&& ((size_t)block * rowsPerBlock) < ((size_t)ScrollTop + ScrollHeight);
+		}
+
+		void ForceRows(const pixel_t top, const pixel_t height)
+		{
+			const uint16_t lastBlock = ((uint32_t)top + height - 1) / rowsPerBlock;
+			for (uint16_t block = top / rowsPerBlock; block <= lastBlock; block++)
+			{
+				ForcedBlocks[block >> 3] |= uint8_t(1) << (block & 7);
+			}
+		}
+
+		bool IsDirty(const uint16_t block) const
+		{
+			return IsBlockSet(DirtyBlocks, block);
+		}
+
+		static bool IsBlockSet(const uint8_t* blocks, const uint16_t block)
+		{
+			return blocks[block >> 3] & (uint8_t(1) << (block & 7));
+		}
+
+		static constexpr size_t GetBlockRows(const uint16_t block)
+		{
+			return (((size_t)block + 1) * rowsPerBlock > ScreenHeight) ? (ScreenHeight - ((size_t)block * rowsPerBlock)) : rowsPerBlock;
+		}
+
+		static uint32_t GetBlockHash(const uint8_t* frameBuffer, const uint16_t block)
+		{
+			return GetHash(&frameBuffer[BLOCK_SIZE * block], GetBlockRows(block) * ROW_SIZE);
+		}
+
+		/// <summary>
+		/// FNV-1a style hash, consuming 32 bit words.
+		/// Each step is a bijection of the running hash, so any single word change is always detected.
+		/// </summary>
+		static uint32_t GetHash(const uint8_t* data, const size_t size)
+		{
+			uint32_t hash = HASH_SEED;
+			size_t i = 0;
+			for (; i + sizeof(uint32_t) <= size; i += sizeof(uint32_t))
+			{
+				uint32_t word;
+				memcpy(&word, &data[i], sizeof(uint32_t));
+				hash = (hash ^ word) * HASH_PRIME;
+			}
+
+			for (; i < size; i++)
+			{
+				hash = (hash ^ data[i]) * HASH_PRIME;
+			}
+
+			return hash;
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -10,26 +10,21 @@
 #if !defined(ARDUINO_ARCH_RP2040) || defined(__FREERTOS)
 #define TEMPLATE_SCREEN_DRIVER_RTOS
 #endif
+#elif !defined(ARDUINO)
+#define TEMPLATE_SCREEN_DRIVER_RTOS
+#endif
 
 #if defined(TEMPLATE_SCREEN_DRIVER_RTOS)
 #include "../Model/IScreenDriver.h"
-
-#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_NRF52)
-#include <Arduino.h>
-#endif
-
-#if defined(ARDUINO_ARCH_RP2040) || defined(ARDUINO_ARCH_NRF52)
-#include <FreeRTOS.h>
-#include <task.h>
-#include <semphr.h>
-#else
-#endif
+#include "RtosTask.h"
 
 namespace Egfx
 {
 	/// <summary>
 	/// Wraps an Inline ScreenDriver with threaded buffer push.
 	/// Non-blocking push and wait until push is done.
+	/// Single-producer/single-consumer handoff: the render side publishes the frame buffer pointer and notifies,
+	/// the buffer task clears it when done. No locks are taken on the render side.
 	/// </summary>
 	template<typename ConstructorParameterType,
 		typename InlineScreenDriver,
@@ -44,48 +39,51 @@ namespace Egfx
 	{
 	private:
 		using BaseClass = InlineScreenDriver;
-		const SemaphoreHandle_t Mutex;
 
 	private:
-		uint8_t* FrameBuffer = nullptr;
-		uint8_t* TaskFrameBuffer = nullptr;
+		RtosTask BufferTask{};
+
+		void (*TaskCallback)(void* parameter) = nullptr;
 
-		TaskFunction_t TaskCallback = nullptr;
+		// Frame buffer handoff, written by the render side when null, cleared by the buffer task when pushed.
+		std::atomic<const uint8_t*> FrameBuffer{ nullptr };
 
-		TaskHandle_t BufferTaskHandle = NULL;
+		std::atomic<bool> TaskReady{ false };
+		std::atomic<bool> TaskRunning{ false };
 
-		volatile bool TaskReady = false;
+		std::atomic<void (*)(void*)> PushCallback{ nullptr };
+		std::atomic<void*> PushParameter{ nullptr };
 
 	public:
 		TemplateScreenDriverRtos(ConstructorParameterType& parameter)
 			: BaseClass(parameter)
-			, Mutex(xSemaphoreCreateMutex())
 		{
 		}
 
 		~TemplateScreenDriverRtos() override
 		{
-			if (Mutex != NULL)
-			{
-				Stop();
-				vSemaphoreDelete(Mutex);
-			}
+			Stop();
 		}
 
 		bool Start() final
 		{
 			if (TaskCallback != nullptr
-				&& Mutex != NULL
+				&& !TaskRunning.load(std::memory_order_acquire)
 				&& BaseClass::Start())
 			{
-#if defined(ARDUINO_ARCH_ESP32)
-				xTaskCreatePinnedToCore(TaskCallback, "BufferTask", stackHeight, this, priority, &BufferTaskHandle, coreAffinity);
-#elif defined(ARDUINO_ARCH_RP2040)
-				xTaskCreateAffinitySet(TaskCallback, "BufferTask", stackHeight, this, priority, coreAffinity, &BufferTaskHandle);
-#else // ESP8266, NRF52, others with FreeRTOS
-				xTaskCreate(TaskCallback, "BufferTask", stackHeight, this, priority, &BufferTaskHandle);
+				FrameBuffer.store(nullptr, std::memory_order_relaxed);
+				TaskReady.store(false, std::memory_order_relaxed);
+				TaskRunning.store(true, std::memory_order_release);
+
+#if defined(TEMPLATE_SCREEN_DRIVER_RTOS_MULTI_CORE)
+				if (BufferTask.Start(TaskCallback, this, stackHeight, priority, coreAffinity))
+#else
+				if (BufferTask.Start(TaskCallback, this, stackHeight, priority, 0))
 #endif
-				return BufferTaskHandle != NULL;
+				{
+					return true;
+				}
+				TaskRunning.store(false, std::memory_order_release);
 			}
 
 			return false;
@@ -93,21 +91,15 @@ namespace Egfx
 
 		void Stop() final
 		{
-			if (BufferTaskHandle != NULL)
+			if (TaskRunning.load(std::memory_order_acquire))
 			{
-				// Wake task so it can observe TaskReady=false (in case it is blocked).
-				xTaskNotifyGive(BufferTaskHandle);
+				// Wake task so it can observe TaskRunning=false, then wait for it to exit.
+				TaskRunning.store(false, std::memory_order_release);
+				BufferTask.Notify();
+				BufferTask.Join();
 
-				if (xSemaphoreTake(Mutex, portMAX_DELAY) == pdTRUE)
-				{
-					TaskReady = false;
-					FrameBuffer = nullptr;
-					TaskFrameBuffer = nullptr;
-					xSemaphoreGive(Mutex);
-				}
-
-				vTaskDelete(BufferTaskHandle);
-				BufferTaskHandle = NULL;
+				TaskReady.store(false, std::memory_order_release);
+				FrameBuffer.store(nullptr, std::memory_order_release);
 			}
 
 			BaseClass::Stop();
@@ -115,18 +107,9 @@ namespace Egfx
 
 		bool CanPushBuffer() final
 		{
-			if (!BaseClass::CanPushBuffer())
-				return false;
-
-			bool can = false;
-			if (xSemaphoreTake(Mutex, portMAX_DELAY) == pdTRUE)
-			{
-				const bool pushing = FrameBuffer != nullptr;
-				can = TaskReady && !pushing;
-				xSemaphoreGive(Mutex);
-			}
-
-			return can;
+			return BaseClass::CanPushBuffer()
+				&& TaskReady.load(std::memory_order_acquire)
+				&& FrameBuffer.load(std::memory_order_acquire) == nullptr;
 		}
 
 		void StartBuffer() final
@@ -135,101 +118,93 @@ namespace Egfx
 
 		uint32_t PushBuffer(const uint8_t* frameBuffer) final
 		{
-			if (xSemaphoreTake(Mutex, portMAX_DELAY) == pdTRUE)
-			{
-				FrameBuffer = (uint8_t*)frameBuffer;
-				xSemaphoreGive(Mutex);
-			}
-
-			// Signal worker task (notification counts; no lost wakeups).
-			if (BufferTaskHandle != NULL)
-			{
-				xTaskNotifyGive(BufferTaskHandle);
-			}
+			// Publish the buffer, then signal the worker task (notification counts; no lost wakeups).
+			FrameBuffer.store(frameBuffer, std::memory_order_release);
+			BufferTask.Notify();
 
 			return pushSleepDuration;
 		}
 
 		bool PushingBuffer(const uint8_t* frameBuffer) final
 		{
-			bool pushing = true;
-			if (xSemaphoreTake(Mutex, portMAX_DELAY) == pdTRUE)
-			{
-				pushing = FrameBuffer != nullptr;
-				xSemaphoreGive(Mutex);
-			}
-
-			return pushing;
+			return FrameBuffer.load(std::memory_order_acquire) != nullptr;
 		}
 
 		void EndBuffer() final
 		{
 		}
 
+		size_t GetPushedSize() final
+		{
+			// Pushed by the buffer task, released only when done.
+			return 0;
+		}
+
 		void SetBufferTaskCallback(void (*taskCallback)(void* parameter)) final
 		{
 			TaskCallback = taskCallback;
 		}
 
-		// Worker task entry point (infinite loop).
+		bool SetPushCallback(void (*pushCallback)(void* parameter), void* parameter) final
+		{
+			PushParameter.store(parameter, std::memory_order_relaxed);
+			PushCallback.store(pushCallback, std::memory_order_release);
+
+			return pushCallback != nullptr;
+		}
+
+		// Worker task entry point, runs until stopped.
 		void BufferTaskCallback(void* parameter) final
 		{
 			TemplateScreenDriverRtos* self = static_cast<TemplateScreenDriverRtos*>(parameter);
 
 			// Prime TaskReady once at task start (before first wait).
-			if (!self->TaskReady)
-			{
-				if (xSemaphoreTake(self->Mutex, portMAX_DELAY) == pdTRUE)
-				{
-					self->TaskReady = true;
-					xSemaphoreGive(self->Mutex);
-				}
-			}
+			self->TaskReady.store(true, std::memory_order_release);
 
 			for (;;)
 			{
-				ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+				self->BufferTask.Wait();
 
-				// Snapshot buffer pointer.
-				if (xSemaphoreTake(self->Mutex, portMAX_DELAY) == pdTRUE)
+				if (!self->TaskRunning.load(std::memory_order_acquire))
 				{
-					self->TaskFrameBuffer = self->FrameBuffer;
-					xSemaphoreGive(self->Mutex);
+					break;
 				}
 
-				if (self->TaskFrameBuffer == nullptr)
+				const uint8_t* frameBuffer = self->FrameBuffer.load(std::memory_order_acquire);
+				if (frameBuffer == nullptr)
 				{
 					continue;
 				}
 
 				self->BaseClass::StartBuffer();
 
-				const uint32_t pushSleepMicro = self->BaseClass::PushBuffer(self->TaskFrameBuffer);
+				const uint32_t pushSleepMicro = self->BaseClass::PushBuffer(frameBuffer);
 
 				if (pushSleepMicro > 0)
 				{
-					const TickType_t delayTicks = pdMS_TO_TICKS(pushSleepMicro / 1000);
-					if (delayTicks > 0)
-						vTaskDelay(delayTicks);
+					RtosTask::Sleep(pushSleepMicro);
 				}
 
-				while (self->BaseClass::PushingBuffer(self->TaskFrameBuffer))
+				while (self->BaseClass::PushingBuffer(frameBuffer))
 				{
-					vTaskDelay(1);
+					RtosTask::Yield();
 				}
 
 				self->BaseClass::EndBuffer();
-				self->TaskFrameBuffer = nullptr;
 
-				if (xSemaphoreTake(self->Mutex, portMAX_DELAY) == pdTRUE)
+				// Hand the buffer back to the render side.
+				self->FrameBuffer.store(nullptr, std::memory_order_release);
+
+				void (*pushCallback)(void*) = self->PushCallback.load(std::memory_order_acquire);
+				if (pushCallback != nullptr)
 				{
-					self->FrameBuffer = nullptr;
-					xSemaphoreGive(self->Mutex);
+					pushCallback(self->PushParameter.load(std::memory_order_relaxed));
 				}
 			}
+
+			self->BufferTask.Exit();
 		}
 	};
 }
 #endif
-#endif
 #endif
\ No newline at end of file
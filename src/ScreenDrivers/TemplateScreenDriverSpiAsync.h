@@ -7,6 +7,14 @@
 
 namespace Egfx
 {
+	/// <summary>
+	/// Chunked blocking SPI push, one chunk per scheduler pass.
+	/// The chunk size is BufferSize / spiChunkDivisor.
+	/// With a maximum blocking duration set, it starts at MIN_CHUNK_SIZE and is then sized at runtime
+	/// from the measured bus throughput, so each pass blocks for at most that long, following SPI clock and load changes.
+	/// </summary>
+	/// <typeparam name="InlineSpiScreenDriver">Inline SPI screen driver.</typeparam>
+	/// <typeparam name="spiChunkDivisor">Initial (and fixed, when not adaptive) number of chunks per frame.</typeparam>
 	template<typename InlineSpiScreenDriver,
 		const uint8_t spiChunkDivisor = 2>
 	class TemplateScreenDriverSpiAsync : public InlineSpiScreenDriver
@@ -15,64 +23,138 @@ namespace Egfx
 		using InlineSpiScreenDriver::BufferSize;
 
 	protected:
-		using InlineSpiScreenDriver::SpiInstance;
+		using InlineSpiScreenDriver::SpiTransfer;
 
 	private:
-		static constexpr size_t CHUNK_SIZE = BufferSize / spiChunkDivisor;
-		static constexpr size_t WHOLE_SIZE = (BufferSize / CHUNK_SIZE) * CHUNK_SIZE;
-		static constexpr size_t REMAINDER_SIZE = BufferSize - WHOLE_SIZE;
-		static constexpr size_t REMAINDER_START = WHOLE_SIZE;
+		static constexpr size_t DEFAULT_CHUNK_SIZE = BufferSize / spiChunkDivisor;
+
+		/// <summary>
+		/// Adaptive chunk floor, keeps the per pass overhead in check on slow buses.
+		/// </summary>
+		static constexpr size_t MIN_CHUNK_SIZE = (DEFAULT_CHUNK_SIZE < 64) ? DEFAULT_CHUNK_SIZE : 64;
+
+		static_assert(BufferSize <= (UINT32_MAX / 1000), "Buffer too large for the 32 bit throughput estimate.");
 
 	private:
 		size_t PushIndex = 0;
+		size_t ChunkSize = DEFAULT_CHUNK_SIZE;
+
+		// Adaptive chunk sizing, disabled when 0.
+		uint32_t MaxBlockingMicros = 0;
+
+		// Smoothed bus throughput, in bytes per millisecond. 0 until measured.
+		uint32_t BytesPerMilli = 0;
+
+		// Throughput at and above which a whole buffer fits in the blocking duration.
+		uint32_t SaturatedBytesPerMilli = 0;
 
 	public:
 		TemplateScreenDriverSpiAsync(Egfx::SpiType& spi) : InlineSpiScreenDriver(spi) {}
 
 		~TemplateScreenDriverSpiAsync() override = default;
 
+		/// <summary>
+		/// Sets the maximum time a push pass may block, in microseconds.
+		/// 0 restores the fixed BufferSize / spiChunkDivisor chunks.
+		/// </summary>
+		void SetMaxBlockingDuration(const uint32_t maxBlockingMicros)
+		{
+			MaxBlockingMicros = maxBlockingMicros;
+			SaturatedBytesPerMilli = (maxBlockingMicros > 0) ? (uint32_t(BufferSize) * 1000) / maxBlockingMicros : 0;
+			UpdateChunkSize();
+		}
+
+		/// <summary>
+		/// Current chunk size in bytes.
+		/// </summary>
+		size_t GetChunkSize() const
+		{
+			return ChunkSize;
+		}
+
+		/// <summary>
+		/// Measured bus throughput in bytes per millisecond, 0 until the first chunk is pushed.
+		/// </summary>
+		uint32_t GetThroughput() const
+		{
+			return BytesPerMilli;
+		}
+
+		size_t GetPushedSize() final
+		{
+			// Chunk transfers are blocking, every started chunk is done.
+			return PushIndex;
+		}
+
 		uint32_t PushBuffer(const uint8_t* frameBuffer) final
 		{
 			PushIndex = 0;
+			PushChunk(frameBuffer);
 
-			if (WHOLE_SIZE > 0)
+			return 0;
+		}
+
+		bool PushingBuffer(const uint8_t* frameBuffer) final
+		{
+			if (PushIndex < BufferSize)
 			{
-#if defined(ARDUINO_ARCH_STM32F1) || defined(ARDUINO_ARCH_STM32F4)
-				SpiInstance.transfer((uint8_t*)frameBuffer, CHUNK_SIZE);
-#else
-				SpiInstance.transfer((void*)frameBuffer, CHUNK_SIZE);
-#endif
-				PushIndex += CHUNK_SIZE;
+				PushChunk(frameBuffer);
 			}
 
-			return 0;
+			return PushIndex < BufferSize;
 		}
 
-		bool PushingBuffer(const uint8_t* frameBuffer) final
+	private:
+		void PushChunk(const uint8_t* frameBuffer)
+		{
+			const size_t remaining = BufferSize - PushIndex;
+			const size_t size = (remaining > ChunkSize) ? ChunkSize : remaining;
+
+			if (MaxBlockingMicros > 0)
+			{
+				const uint32_t start = micros();
+				SpiTransfer(&frameBuffer[PushIndex], size);
+				Measure(size, micros() - start);
+			}
+			else
+			{
+				SpiTransfer(&frameBuffer[PushIndex], size);
+			}
+
+			PushIndex += size;
+		}
+
+		void Measure(const size_t size, const uint32_t duration)
+		{
+			const uint32_t sample = (uint32_t(size) * 1000) / ((duration > 0) ? duration : 1);
+
+			// Exponential moving average (1/4), follows clock and load changes within a few chunks.
+			BytesPerMilli = (BytesPerMilli == 0) ? sample : (BytesPerMilli - (BytesPerMilli / 4) + (sample / 4));
+
+			UpdateChunkSize();
+		}
+
+		void UpdateChunkSize()
 		{
-			if (PushIndex < WHOLE_SIZE)
+			if (MaxBlockingMicros == 0)
 			{
-#if defined(ARDUINO_ARCH_STM32F1) || defined(ARDUINO_ARCH_STM32F4)
-				SpiInstance.transfer((uint8_t*)&frameBuffer[PushIndex], CHUNK_SIZE);
-#else
-				SpiInstance.transfer((void*)&frameBuffer[PushIndex], CHUNK_SIZE);
-#endif
-				PushIndex += CHUNK_SIZE;
-
-				return true;
+				ChunkSize = DEFAULT_CHUNK_SIZE;
+			}
+			else if (BytesPerMilli == 0)
+			{
+				// Unknown throughput, measure on the smallest chunk.
+				ChunkSize = MIN_CHUNK_SIZE;
+			}
+			else if (BytesPerMilli >= SaturatedBytesPerMilli)
+			{
+				ChunkSize = BufferSize;
 			}
 			else
 			{
-				if (REMAINDER_SIZE > 0)
-				{
-#if defined(ARDUINO_ARCH_STM32F1) || defined(ARDUINO_ARCH_STM32F4)
-					SpiInstance.transfer((uint8_t*)&frameBuffer[REMAINDER_START], CHUNK_SIZE);
-#else
-					SpiInstance.transfer((void*)&frameBuffer[REMAINDER_START], REMAINDER_SIZE);
-#endif
-				}
-
-				return false;
+				// Below saturation, the product is under BufferSize * 1000.
+				const uint32_t chunk = (BytesPerMilli * MaxBlockingMicros) / 1000;
+
+				ChunkSize = (chunk < MIN_CHUNK_SIZE) ? MIN_CHUNK_SIZE : size_t(chunk);
 			}
 		}
 	};
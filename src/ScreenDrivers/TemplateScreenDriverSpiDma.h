@@ -26,6 +26,11 @@ namespace Egfx
 	private:
 		volatile bool _pushInProgress = false;
 
+#if defined(ARDUINO_ARCH_ESP32)
+		void (*PushCallback)(void* parameter) = nullptr;
+		void* PushParameter = nullptr;
+#endif
+
 #if defined(ARDUINO_ARCH_STM32F1) || defined(ARDUINO_ARCH_STM32F4)
 	private: // Some DMA controllers are limited in the transaction size, async style implementation to work around.
 		static constexpr size_t CHUNK_SIZE = BufferSize / pushChunckMaxSize;
@@ -34,6 +39,7 @@ namespace Egfx
 		static constexpr size_t REMAINDER_START = WHOLE_SIZE;
 
 		size_t PushIndex = 0;
+		size_t PushedSize = 0;
 #endif
 
 	public:
@@ -54,6 +60,32 @@ namespace Egfx
 			return InlineSpiScreenDriver::Start();
 		}
 
+		bool SetPushCallback(void (*pushCallback)(void* parameter), void* parameter) override
+		{
+#if defined(ARDUINO_ARCH_ESP32)
+			// Raised from the IDF transaction post-callback, on every completed chunk.
+			PushCallback = pushCallback;
+			PushParameter = parameter;
+			SpiInstance.SetTransferCallback(pushCallback, parameter);
+			return pushCallback != nullptr;
+#else
+			// STM32 and RP2040 SPI libraries expose no completion hook for their DMA helpers, PushingBuffer() is polled.
+			return false;
+#endif
+		}
+
+		size_t GetPushedSize() final
+		{
+#if defined(ARDUINO_ARCH_STM32F4)
+			return PushedSize;
+#elif defined(ARDUINO_ARCH_ESP32)
+			return SpiInstance.DmaCompletedSize();
+#else
+			// Single transfer, nothing is released until done.
+			return 0;
+#endif
+		}
+
 		uint32_t PushBuffer(const uint8_t* frameBuffer) final
 		{
 			_pushInProgress = true;
@@ -63,6 +95,7 @@ namespace Egfx
 			return pushSleepDuration;
 #elif defined(ARDUINO_ARCH_STM32F4)
 			PushIndex = 0;
+			PushedSize = 0;
 			if (WHOLE_SIZE > 0)
 			{
 				SpiInstance.dmaSend((void*)frameBuffer, (uint16_t)CHUNK_SIZE, true);
@@ -77,15 +110,16 @@ namespace Egfx
 			// Make sure the IDF DMA backend is ready. Mode is assumed SPI_MODE0 for display drivers.
 			// Clock defaults to Esp32Spi's internal value unless configured by caller.
 			// No HW-CS: inline driver controls CS via GPIO.
-			if (!SpiInstance.DmaBegin(80000000, SPI_MODE0, false))
+			if (!SpiInstance.DmaBegin(80000000, SPI_MODE0, false)
+				|| !SpiInstance.DmaWriteAsync(frameBuffer, BufferSize))
 			{
 				_pushInProgress = false;
-				return 0;
-			}
 
-			if (!SpiInstance.DmaWriteAsync(frameBuffer, BufferSize))
-			{
-				_pushInProgress = false;
+				// No transfer will complete, signal the failed push for PushingBuffer() to end it.
+				if (PushCallback != nullptr)
+				{
+					PushCallback(PushParameter);
+				}
 				return 0;
 			}
 
@@ -105,6 +139,7 @@ namespace Egfx
 #elif defined(ARDUINO_ARCH_STM32F4)
 			if (SpiInstance.dmaSendReady())
 			{
+				PushedSize = PushIndex;
 				if (PushIndex < WHOLE_SIZE)
 				{
 					SpiInstance.dmaSend((void*)&frameBuffer[PushIndex], (uint16_t)CHUNK_SIZE, true);